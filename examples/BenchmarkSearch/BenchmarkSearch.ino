@@ -0,0 +1,118 @@
+/*
+ ******************************************************************************
+ *  BenchmarkSearch.ino
+ *
+ *  Benchmark of the search strategies of ordered collections.
+ *
+ *  Author: Pierre DEBAS
+ *  Copyright (c) 2026
+ *
+ *  MIT License
+ *  https://github.com/Pierrolefou881/DuinoCollections
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Description:
+ *    This sketch times BinarySearch (the former search loop of ordered
+ *    collections), BranchlessSearch and InterpolationSearch on the same
+ *    sorted data and the same keys, then the matching FixedOrderedSet::find
+ *    calls. Evenly spaced values favor InterpolationSearch, squared values
+ *    make it fall back to BinarySearch. Results are printed once, in
+ *    nanoseconds per lookup.
+ *
+ ******************************************************************************
+ */
+#include <FixedOrderedSet.hpp>
+#include <SearchStrategy.hpp>
+
+const size_t DATA_SIZE{ 256 };
+const size_t KEY_COUNT{ 64 };
+const uint16_t ROUNDS{ 50 };
+
+uint16_t data[DATA_SIZE];
+uint16_t keys[KEY_COUNT];
+volatile size_t sink{ };
+
+void print_result(const char* name, unsigned long elapsed) {
+  Serial.print(name);
+  Serial.print('\t');
+  Serial.print(elapsed * 1000.0 / (static_cast<unsigned long>(ROUNDS) * KEY_COUNT));
+  Serial.println(" ns/lookup");
+}
+
+template<typename Search>
+void time_search(const char* name) {
+  Search search{ };
+  DuinoCollections::Ascending<uint16_t> order{ };
+
+  unsigned long start = micros();
+  for (uint16_t round = 0; round < ROUNDS; round++)
+  {
+    for (size_t i = 0; i < KEY_COUNT; i++)
+    {
+      sink = sink + search.lower_bound(data, DATA_SIZE, keys[i], order);
+    }
+  }
+  print_result(name, micros() - start);
+}
+
+template<typename Search>
+void time_find(const char* name) {
+  DuinoCollections::FixedOrderedSet<uint16_t, DuinoCollections::Ascending<uint16_t>, DATA_SIZE, Search> set;
+  for (size_t i = 0; i < DATA_SIZE; i++)
+  {
+    set.insert(data[i]);
+  }
+
+  unsigned long start = micros();
+  for (uint16_t round = 0; round < ROUNDS; round++)
+  {
+    for (size_t i = 0; i < KEY_COUNT; i++)
+    {
+      sink = sink + set.find(keys[i]);
+    }
+  }
+  print_result(name, micros() - start);
+}
+
+// Half of the keys are present, the other half fall between two values.
+void make_keys(void) {
+  for (size_t i = 0; i < KEY_COUNT; i++)
+  {
+    auto value = data[random(DATA_SIZE)];
+    keys[i] = (i & 1) ? value + 1 : value;
+  }
+}
+
+void run_all(const char* title) {
+  make_keys();
+  Serial.println(title);
+  time_search<DuinoCollections::BinarySearch>("BinarySearch");
+  time_search<DuinoCollections::BranchlessSearch>("BranchlessSearch");
+  time_search<DuinoCollections::InterpolationSearch>("InterpolationSearch");
+  time_find<DuinoCollections::BinarySearch>("find, BinarySearch");
+  time_find<DuinoCollections::BranchlessSearch>("find, BranchlessSearch");
+  time_find<DuinoCollections::InterpolationSearch>("find, InterpolationSearch");
+  Serial.println();
+}
+
+void setup() {
+  Serial.begin(9600);
+  randomSeed(42);
+
+  for (size_t i = 0; i < DATA_SIZE; i++)
+  {
+    data[i] = static_cast<uint16_t>(i * 200 + random(100));
+  }
+  run_all("Evenly spaced values:");
+
+  for (size_t i = 0; i < DATA_SIZE; i++)
+  {
+    data[i] = static_cast<uint16_t>(i * i);
+  }
+  run_all("Squared values:");
+}
+
+void loop() {
+  // Results are printed once by setup.
+}
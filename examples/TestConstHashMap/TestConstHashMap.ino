@@ -0,0 +1,111 @@
+/*
+ ******************************************************************************
+ *  TestConstHashMap.ino
+ *
+ *  Testbed and examples for the ConstHashMap collection.
+ *
+ *  Author: Pierre DEBAS
+ *  Copyright (c) 2026
+ *
+ *  MIT License
+ *  https://github.com/Pierrolefou881/DuinoCollections
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Description:
+ *    This sketch provides tests and use case examples for the ConstHashMap
+ *    collection, part of the DuinoCollections library.
+ *    A command dispatcher lives in PROGMEM and is read with try_get_P, a
+ *    channel to pin map lives in RAM and is read with try_get. Both tables
+ *    are built by the compiler: setup() does not fill anything.
+ *
+ *    Requires C++14: the AVR core compiles with -std=gnu++11 by default,
+ *    see the ConstHashMap section of the README to switch to -std=gnu++14.
+ *
+ ******************************************************************************
+ */
+#include <ConstHashMap.hpp>
+
+#if __cplusplus < 201402L
+#error "ConstHashMap requires C++14, compile with -std=gnu++14."
+#endif
+
+using Handler = void (*)(void);
+
+int led_state{ };
+unsigned long counter{ };
+
+void ping() {
+  Serial.println("PONG");
+}
+
+void reset_counter() {
+  counter = 0;
+  Serial.println("COUNTER RESET");
+}
+
+void status() {
+  Serial.print("COUNTER:\t");
+  Serial.println(counter);
+}
+
+void toggle_led() {
+  led_state ^= HIGH;
+  digitalWrite(LED_BUILTIN, led_state);
+}
+
+constexpr DuinoCollections::ConstKeyValue<uint8_t, Handler> COMMAND_LIST[]{
+  { 0x01, &ping }, { 0x10, &reset_counter }, { 0x22, &status }, { 0x47, &toggle_led }
+};
+constexpr auto COMMANDS PROGMEM = DuinoCollections::make_const_hash_map(COMMAND_LIST);
+
+constexpr DuinoCollections::ConstKeyValue<char, uint8_t> CHANNEL_LIST[]{
+  { 'A', 2 }, { 'B', 3 }, { 'C', 5 }, { 'D', 6 }, { 'E', 9 }
+};
+constexpr auto CHANNELS = DuinoCollections::make_const_hash_map(CHANNEL_LIST);
+
+static_assert(COMMANDS.size() == 4, "One slot per command");
+
+// 0x05 and 'Z' are unknown and must not be found.
+const uint8_t codes[] = { 0x01, 0x22, 0x05, 0x47, 0x10, 0x22, 0x47 };
+const char channels[] = { 'A', 'E', 'Z', 'C', 'B', 'D', 'A' };
+const int size{ 7 };
+int index{ };
+
+void setup() {
+  Serial.begin(9600);
+  pinMode(LED_BUILTIN, OUTPUT);
+}
+
+void loop() {
+  Handler handler{ };
+  if (COMMANDS.try_get_P(codes[index], handler))
+  {
+    handler();
+  }
+  else
+  {
+    Serial.print(codes[index], HEX);
+    Serial.println("\tUNKNOWN COMMAND");
+  }
+
+  uint8_t pin{ };
+  Serial.print(channels[index]);
+  if (CHANNELS.try_get(channels[index], pin))
+  {
+    Serial.print("\tPIN ");
+    Serial.println(pin);
+  }
+  else
+  {
+    Serial.println("\tNO SUCH CHANNEL");
+  }
+
+  if (!COMMANDS.contains_P(0x05) && CHANNELS.contains('A'))
+  {
+    counter++;
+  }
+
+  index = (index + 1) % size;
+  delay(1000);
+}
@@ -0,0 +1,114 @@
+/*
+ ******************************************************************************
+ *  TestHashMap.ino
+ *
+ *  Testbed and examples for the FixedHashMap collection.
+ *
+ *  Author: Pierre DEBAS
+ *  Copyright (c) 2026
+ *
+ *  MIT License
+ *  https://github.com/Pierrolefou881/DuinoCollections
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Description:
+ *    This sketch provides tests and use case examples for the FixedHashMap
+ *    collection, part of the DuinoCollections library.
+ *    Entries are printed in bucket order, which is neither insertion nor
+ *    key order. Once the map is full, every other key is removed before
+ *    the map is cleared, so lookups run across backward-shifted entries.
+ *
+ ******************************************************************************
+ */
+#include <FixedHashMap.hpp>
+
+#define _INLINE
+
+const size_t MAX_CAPACITY{ 8 };
+
+#ifdef _INLINE
+// At most 60% of the buckets are used.
+DuinoCollections::FixedHashMap<int, float, DuinoCollections::IntegralHash<int>, MAX_CAPACITY, 60> the_map;
+#else
+DuinoCollections::FixedHashMap<int, float> the_map{ MAX_CAPACITY };
+#endif
+const int keys[] = { 3, 20, 5, 1, 16, 6, 18, 1, 4 };
+const float values[] = { 10e6, NAN, .0, 5.7, -10e3, 10e-4, INFINITY, 1.0, PI};
+const int size{ 9 };
+int index{ };
+int led_state{ };
+
+void setup() {
+  Serial.begin(9600);
+  pinMode(LED_BUILTIN, OUTPUT);
+}
+
+void loop() {
+    if (the_map.is_full())
+    {
+      float removed{ };
+      for (int i = 0; i < size; i += 2)
+      {
+        if (the_map.remove(keys[i], removed))
+        {
+          Serial.print(removed);
+          Serial.println("\tWAS REMOVED");
+        }
+      }
+      print_map();
+      print_lookups();
+
+      the_map.clear();
+      index = 0;
+      if (!the_map.remove(3, removed))
+      {
+        Serial.println("KEY NOT FOUND OR MAP IS EMPTY");
+      }
+    }
+    else
+    {
+      if(!the_map.add(keys[index], values[index]))
+      {
+        Serial.println("KEY DUPLICATION DETECTED");
+      }
+      print_map();
+
+      float current{ };
+      if (the_map.try_get(keys[index], current))
+      {
+        Serial.print("Current Element:\t");
+        Serial.println(current);
+      }
+      index++;
+    }
+
+    led_state ^= HIGH;
+    digitalWrite(LED_BUILTIN, led_state);
+    delay(2000);
+}
+
+void print_map() {
+  for (auto& keyval : the_map)
+  {
+    // Uncomment to check assignment. keyval should be const
+    // and the following line should not compile.
+    // keyval.value = 0;
+
+    Serial.print('<');
+    Serial.print(keyval.key);
+    Serial.print(", ");
+    Serial.print(keyval.value);
+    Serial.print(">, ");
+  }
+  Serial.print('\t');
+  Serial.println(the_map.size());
+}
+
+void print_lookups() {
+  for (int i = 0; i < size; i++)
+  {
+    Serial.print(keys[i]);
+    Serial.println(the_map.contains(keys[i]) ? "\tFOUND" : "\tMISSING");
+  }
+}
@@ -0,0 +1,83 @@
+/*
+ ******************************************************************************
+ *  TestHashSet.ino
+ *
+ *  Testbed and examples for the FixedHashSet collection.
+ *
+ *  Author: Pierre DEBAS
+ *  Copyright (c) 2026
+ *
+ *  MIT License
+ *  https://github.com/Pierrolefou881/DuinoCollections
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Description:
+ *    This sketch provides tests and use case examples for the FixedHashSet
+ *    collection, part of the DuinoCollections library.
+ *    IDs share their low byte so that IntegralHash has to mix the high byte
+ *    in. Removals move the last element into the freed index, so the
+ *    printed order changes as elements are erased.
+ *
+ ******************************************************************************
+ */
+#include <FixedHashSet.hpp>
+
+#define _INLINE
+
+const size_t MAX_CAPACITY{ 8 };
+const uint16_t data_set[] = { 0x0142, 0x0242, 0x0342, 0x0442, 0x0242, 0x0542, 0x0642, 0x0742 };
+const uint16_t to_remove[] = { 0x0342, 0x0142, 0x0742, 0x0342, 0x0542, 0x0242, 0x0642, 0x0442 };
+const uint16_t probe{ 0x0442 };
+const int size{ 8 };
+bool is_removing{ };
+int index{ };
+
+#ifdef _INLINE
+DuinoCollections::FixedHashSet<uint16_t, DuinoCollections::IntegralHash<uint16_t>, MAX_CAPACITY> set;
+#else
+DuinoCollections::FixedHashSet<uint16_t> set{ MAX_CAPACITY };
+#endif
+
+void setup() {
+  Serial.begin(9600);
+}
+
+void loop() {
+  if (index < size)
+  {
+    if (is_removing && !set.erase(to_remove[index]))
+    {
+      Serial.println("ELEMENT NOT FOUND");
+    }
+    else if (!is_removing && !set.insert(data_set[index]))
+    {
+      Serial.println("TRIED TO INSERT DUPLICATE");
+    }
+
+    print_set();
+    index++;
+  }
+  else
+  {
+    index = 0;
+    is_removing ^= true;
+  }
+  delay(1000);
+}
+
+void print_set() {
+  for (auto& item : set)
+  {
+    // Uncomment to check assignment. item should be const
+    // and the following line should not compile.
+    // item = 0;
+
+    Serial.print(item, HEX);
+    Serial.print(", ");
+  }
+  Serial.print('\t');
+  Serial.print(set.size());
+  Serial.print('\t');
+  Serial.println(set.contains(probe) ? "PROBE FOUND" : "PROBE MISSING");
+}
@@ -15,6 +15,10 @@
  *  Description:
  *    This sketch provides tests and use case examples for the FixedMap
  *    collection, part of the DuinoCollections library.
+ *    setup() freezes an inline map, looks it up in frozen layout and
+ *    thaws it back, then queries time windows of timestamped readings.
+ *    range(lo, hi) and erase_range(lo, hi) are half-open: the reading
+ *    at hi is excluded.
  *
  ******************************************************************************
  */
@@ -26,9 +30,15 @@ const float values[] = { 10e6, NAN, .0, 5.7, -10e3, 10e-4, INFINITY, 1.0, PI};
 int index{ };
 int led_state{ };
 
+// Inline map exercised once by setup().
+using Table = DuinoCollections::FixedMap<int, float, 8>;
+
 void setup() {
   Serial.begin(9600);
   pinMode(LED_BUILTIN, OUTPUT);
+  test_freeze();
+  test_ranges();
+  test_erase_range();
 }
 
 void loop() {
@@ -80,4 +90,117 @@ void print_map() {
   }
   Serial.print('\t');
   Serial.println(the_map.size());
-}
\ No newline at end of file
+}
+
+void print_table(const Table& table) {
+  for (auto keyval : table)
+  {
+    Serial.print(keyval.key);
+    Serial.print(", ");
+  }
+  Serial.print('\t');
+  Serial.println(table.is_frozen() ? "FROZEN" : "SORTED");
+}
+
+void test_freeze() {
+  Table table{ };
+  for (int i = 0; i < 9; i++)
+  {
+    table.add(keys[i], values[i]);
+  }
+  print_table(table);
+
+  // Iteration and indexes follow the frozen layout, not the key order.
+  table.freeze();
+  print_table(table);
+
+  float current{ };
+  if (table.try_get(16, current))
+  {
+    Serial.print("FROZEN LOOKUP OF 16:\t");
+    Serial.println(current);
+  }
+
+  // Positions in key order still work, through select.
+  Serial.print("FIRST KEY FROM 7: ");
+  Serial.println(table.select(table.lower_bound(7)).key);
+
+  // find returns a frozen slot: remove_at takes it as is and thaws the map.
+  DuinoCollections::KeyValue<int, float> removed{ };
+  auto index = table.find(5);
+  Serial.print("5 AT FROZEN INDEX ");
+  Serial.println(index);
+  if (table.remove_at(index, removed))
+  {
+    Serial.print(removed.key);
+    Serial.println("\tWAS REMOVED");
+  }
+  print_table(table);
+
+  table.freeze();
+  table.thaw();
+  print_table(table);
+}
+
+void print_window(const char* name, const Table& readings, DuinoCollections::IndexRange positions) {
+  Serial.print(name);
+  Serial.print('\t');
+  for (auto position = positions.first; position < positions.last; position++)
+  {
+    auto& reading = readings.select(position);
+    Serial.print('<');
+    Serial.print(reading.key);
+    Serial.print(", ");
+    Serial.print(reading.value);
+    Serial.print(">, ");
+  }
+  Serial.print('\t');
+  Serial.println(positions.size());
+}
+
+void test_ranges() {
+  // Temperature readings by second.
+  const int seconds[] = { 0, 5, 10, 15, 20, 25, 30, 35 };
+  const float temperatures[] = { 21.5, 21.7, 22.0, 22.4, 22.3, 22.9, 23.1, 23.0 };
+  Table readings{ };
+  for (int i = 0; i < 8; i++)
+  {
+    readings.add(seconds[i], temperatures[i]);
+  }
+
+  // [10, 20) excludes the reading at 20 s, unlike an inclusive std::map
+  // style loop. For [10, 20], end at upper_bound(20) instead.
+  print_window("WINDOW [10, 20)", readings, readings.range(10, 20));
+  print_window("WINDOW [10, 20]", readings, { readings.lower_bound(10), readings.upper_bound(20) });
+  Serial.print("READINGS IN [12, 28)\t");
+  Serial.println(readings.count_in_range(12, 28));
+
+  // Readings before 17 s, and the median reading.
+  Serial.print("RANK OF 17\t");
+  Serial.println(readings.rank(17));
+  Serial.print("MEDIAN AT\t");
+  Serial.println(readings.select(readings.size() / 2).key);
+}
+
+void test_erase_range() {
+  Table readings{ };
+  for (int second = 0; second < 40; second += 5)
+  {
+    readings.add(second, 20.0 + second / 10.0);
+  }
+
+  // Drops the readings older than 15 s, the one at 15 s is kept.
+  Serial.print("ERASED IN [0, 15)\t");
+  Serial.println(readings.erase_range(0, 15));
+  print_window("KEPT", readings, { 0, readings.size() });
+
+  // Nothing in the window: a frozen map stays frozen.
+  readings.freeze();
+  Serial.print("ERASED IN [100, 200)\t");
+  Serial.println(readings.erase_range(100, 200));
+  print_table(readings);
+
+  Serial.print("ERASED IN [20, 30)\t");
+  Serial.println(readings.erase_range(20, 30));
+  print_table(readings);
+}
@@ -15,6 +15,10 @@
  *  Description:
  *    This sketch provides tests and use case examples for the FixedOrderedSet
  *    collection, part of the DuinoCollections library.
+ *    setup() freezes an inline set, looks it up in frozen layout and
+ *    thaws it back, then runs set algebra on inline sets, including the
+ *    cases where the destination is one of the operands, and range
+ *    queries. range(lo, hi) is half-open: hi itself is excluded.
  *
  ******************************************************************************
  */
@@ -39,8 +43,14 @@ DuinoCollections::FixedOrderedSet<char> set{ MAX_CAPACITY };
 // Check compilation. FixedOrderedSet already tests all functionalities of FixedSet.
 DuinoCollections::FixedSet<int> unordered{ };
 
+// Inline sets exercised once by setup().
+using Letters = DuinoCollections::FixedOrderedSet<char, DuinoCollections::Ascending<char>, MAX_CAPACITY>;
+
 void setup() {
   Serial.begin(9600);
+  test_freeze();
+  test_set_algebra();
+  test_ranges();
 }
 
 void loop() {
@@ -78,4 +88,120 @@ void print_set() {
   }
   Serial.print('\t');
   Serial.println(set.size());
-}
\ No newline at end of file
+}
+
+void print_letters(const Letters& letters) {
+  for (auto letter : letters)
+  {
+    Serial.print(letter);
+  }
+  Serial.print('\t');
+  Serial.println(letters.is_frozen() ? "FROZEN" : "SORTED");
+}
+
+void test_freeze() {
+  Letters letters{ };
+  letters.insert_range(data_set, data_set + size);
+  print_letters(letters);
+
+  // Iteration and indexes follow the frozen layout, not the sorting order.
+  letters.freeze();
+  print_letters(letters);
+
+  auto index = letters.find('M');
+  Serial.print("'M' AT FROZEN INDEX ");
+  Serial.println(index);
+
+  // Positions in sorting order still work, through select.
+  auto position = letters.lower_bound('N');
+  Serial.print("FIRST FROM 'N': ");
+  Serial.println(letters.select(position));
+
+  // index is a frozen slot: remove_at takes it as is and thaws the set.
+  char removed{ };
+  if (letters.remove_at(index, removed))
+  {
+    Serial.print(removed);
+    Serial.println("\tWAS REMOVED");
+  }
+  print_letters(letters);
+
+  letters.freeze();
+  letters.thaw();
+  print_letters(letters);
+}
+
+void print_result(const char* name, bool is_done, const Letters& letters) {
+  Serial.print(name);
+  Serial.print(is_done ? "\tOK\t" : "\tFAILED\t");
+  print_letters(letters);
+}
+
+void test_set_algebra() {
+  const char word_letters[] = { 'd', 'u', 'i', 'n', 'o' };
+  const char vowel_letters[] = { 'a', 'e', 'i', 'o', 'u' };
+  Letters word{ };
+  Letters vowels{ };
+  word.insert_range(word_letters, word_letters + 5);
+  vowels.insert_range(vowel_letters, vowel_letters + 5);
+
+  Letters result{ };
+  Serial.println(word.includes(vowels) ? "WORD INCLUDES VOWELS" : "WORD MISSES VOWELS");
+  print_result("INTERSECTION", result.set_intersection(word, vowels), result);
+  Serial.println(vowels.includes(result) ? "VOWELS INCLUDE IT" : "VOWELS MISS IT");
+  print_result("UNION", result.set_union(word, vowels), result);
+  print_result("DIFFERENCE", result.set_difference(word, vowels), result);
+
+  // Sets of another capacity mix freely, but the result must fit.
+  DuinoCollections::FixedOrderedSet<char, DuinoCollections::Ascending<char>, 4> small{ };
+  Serial.println(small.set_union(word, vowels) ? "SMALL UNION OK" : "SMALL UNION DOES NOT FIT");
+
+  // The destination may be first, or second for union and intersection.
+  // Not for difference: vowels - word cannot be written into word.
+  Letters consonants{ };
+  consonants.set_union(word, consonants);
+  print_result("WORD - VOWELS IN PLACE", consonants.set_difference(consonants, vowels), consonants);
+  print_result("VOWELS - WORD INTO WORD", word.set_difference(vowels, word), word);
+
+  // In place forms, with the destination as implicit first operand.
+  word.set_difference(vowels);
+  print_result("IN PLACE DIFFERENCE", true, word);
+  word.set_intersection(vowels);
+  print_result("IN PLACE INTERSECTION", true, word);
+  print_result("IN PLACE UNION", word.set_union(vowels), word);
+}
+
+void print_range(const char* name, const Letters& letters, DuinoCollections::IndexRange positions) {
+  Serial.print(name);
+  Serial.print('\t');
+  for (auto position = positions.first; position < positions.last; position++)
+  {
+    Serial.print(letters.select(position));
+  }
+  Serial.print('\t');
+  Serial.println(positions.size());
+}
+
+void test_ranges() {
+  Letters letters{ };
+  letters.insert_range(data_set, data_set + size);
+  print_letters(letters);
+
+  // [b, n) stops before n. For [b, n], end at upper_bound(n) instead.
+  print_range("RANGE [b, n)", letters, letters.range('b', 'n'));
+  print_range("RANGE [b, n]", letters, { letters.lower_bound('b'), letters.upper_bound('n') });
+  Serial.print("COUNT IN [A, Z)\t");
+  Serial.println(letters.count_in_range('A', 'Z'));
+
+  // Ranks count the letters before, whether the letter is present or not.
+  Serial.print("RANK OF 'c'\t");
+  Serial.println(letters.rank('c'));
+  Serial.print("RANK OF 'f'\t");
+  Serial.println(letters.rank('f'));
+  Serial.print("MEDIAN\t");
+  Serial.println(letters.select(letters.size() / 2));
+
+  // Same positions once frozen.
+  letters.freeze();
+  print_range("FROZEN [b, n)", letters, letters.range('b', 'n'));
+}
@@ -15,6 +15,10 @@
  *  Description:
  *    This sketch provides tests and use case examples for the FixedRingBuffer
  *    collection, part of the DuinoCollections library.
+ *    Rising edges on PULSE_PIN are timestamped by an interrupt into a
+ *    lock-free SPSC buffer, which loop() drains without disabling interrupts.
+ *    Block transfers (push_n, pop_n), zero-copy writes (reserve, commit) and
+ *    zero-copy reads (peek_contiguous, consume) are run once by setup().
  *
  ******************************************************************************
  */
@@ -26,7 +30,9 @@
 // #define _CLEAR
 
 const int CAPACITY{ 6 };
+const int PULSE_PIN{ 2 };
 const char letters[] = { 'F', 'o', 'o', 'B', 'A', 'R', 'R', 'd', 'U', 'i', 'N', 'o' };
+const size_t LETTER_COUNT{ sizeof(letters) };
 
 #ifdef _OVERWRITE
 DuinoCollections::FixedRingBuffer<char, DuinoCollections::RingBufferMode::OVERWRITE> buffer{ CAPACITY };
@@ -36,11 +42,22 @@ DuinoCollections::FixedRingBuffer<char> buffer{ CAPACITY };
 int index{ };
 bool is_popping{ };
 
+// Producer: the pulse ISR only. Consumer: loop() only.
+DuinoCollections::FixedRingBuffer<unsigned long, DuinoCollections::RingBufferMode::SPSC, 16> pulses;
+DuinoCollections::FixedRingBuffer<char, DuinoCollections::RingBufferMode::REJECT, 8> blocks;
+
 
 void setup() {
     Serial.begin(9600);
     DuinoCollections::FixedRingBuffer<int> five{ };
     Serial.println(five.capacity());
+
+    pinMode(PULSE_PIN, INPUT_PULLUP);
+    attachInterrupt(digitalPinToInterrupt(PULSE_PIN), on_pulse, RISING);
+
+    test_blocks();
+    test_reserve();
+    test_peek();
 }
 
 void loop() {
@@ -69,9 +86,26 @@ void loop() {
     }
 
     print_buffer();
+    print_pulses();
     delay(500);
 }
 
+void on_pulse()
+{
+    // Dropped when loop() lags more than 16 pulses behind.
+    pulses.push(micros());
+}
+
+void print_pulses()
+{
+    unsigned long timestamp{ };
+    while (pulses.pop(timestamp))
+    {
+        Serial.print("PULSE AT ");
+        Serial.println(timestamp);
+    }
+}
+
 void print_buffer()
 {
 #ifdef _RANGE_FOR
@@ -93,4 +127,67 @@ void print_buffer()
     }
     Serial.print('\t');
     Serial.println(buffer.size());
-}
\ No newline at end of file
+}
+
+void test_blocks()
+{
+    // Only the first 8 letters fit.
+    Serial.print("PUSHED ");
+    Serial.println(blocks.push_n(letters, LETTER_COUNT));
+
+    char out[LETTER_COUNT]{ };
+    auto popped = blocks.pop_n(out, 5);
+    Serial.print("POPPED ");
+    Serial.write(out, popped);
+    Serial.println();
+
+    // The last 4 letters wrap around the end of the storage.
+    blocks.push_n(letters + 8, LETTER_COUNT - 8);
+    print_blocks();
+}
+
+void test_reserve()
+{
+    char _[LETTER_COUNT]{ };
+    blocks.pop_n(_, blocks.size());
+
+    // memcpy stands for a driver writing straight into the buffer.
+    // Each region stops at the end of the storage, hence the loop.
+    size_t written{ };
+    auto region = blocks.reserve(LETTER_COUNT);
+    while (region.length > 0)
+    {
+        memcpy(region.data, letters + written, region.length);
+        blocks.commit(region.length);
+        written += region.length;
+        Serial.print("COMMITTED ");
+        Serial.println(region.length);
+        region = blocks.reserve(LETTER_COUNT - written);
+    }
+    print_blocks();
+}
+
+void test_peek()
+{
+    // Elements are written from the storage without copying them out.
+    auto region = blocks.peek_contiguous();
+    while (region.length > 0)
+    {
+        Serial.print("PEEKED ");
+        Serial.write(region.data, region.length);
+        Serial.println();
+        blocks.consume(region.length);
+        region = blocks.peek_contiguous();
+    }
+    print_blocks();
+}
+
+void print_blocks()
+{
+    for (auto letter : blocks)
+    {
+        Serial.print(letter);
+    }
+    Serial.print('\t');
+    Serial.println(blocks.size());
+}
@@ -0,0 +1,123 @@
+/*
+ ******************************************************************************
+ *  TestSplitMap.ino
+ *
+ *  Testbed and examples for the FixedSplitMap collection.
+ *
+ *  Author: Pierre DEBAS
+ *  Copyright (c) 2026
+ *
+ *  MIT License
+ *  https://github.com/Pierrolefou881/DuinoCollections
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Description:
+ *    This sketch provides tests and use case examples for the FixedSplitMap
+ *    collection, part of the DuinoCollections library.
+ *    Sensor ids are mapped to calibrations much larger than the ids, which
+ *    is the case FixedSplitMap is meant for. Calibrations are built in place
+ *    with emplace and tuned through value_at.
+ *
+ ******************************************************************************
+ */
+#include <FixedSplitMap.hpp>
+
+#define _INLINE
+
+struct Calibration
+{
+  float gain[4];
+  float offset[4];
+
+  Calibration(float base_gain = 1.0f)
+  {
+    for (int i = 0; i < 4; i++)
+    {
+      gain[i] = base_gain;
+      offset[i] = .0f;
+    }
+  }
+};
+
+const size_t MAX_CAPACITY{ 6 };
+
+#ifdef _INLINE
+DuinoCollections::FixedSplitMap<uint8_t, Calibration, MAX_CAPACITY> calibrations;
+#else
+DuinoCollections::FixedSplitMap<uint8_t, Calibration> calibrations{ MAX_CAPACITY };
+#endif
+const uint8_t sensors[] = { 12, 3, 40, 7, 3, 25, 1 };
+const float gains[] = { 1.5f, .98f, 2.0f, 1.1f, .5f, 1.02f, 3.3f };
+int index{ };
+int led_state{ };
+
+void setup() {
+  Serial.begin(9600);
+  pinMode(LED_BUILTIN, OUTPUT);
+}
+
+void loop() {
+  if (calibrations.is_full())
+  {
+    Calibration removed{ };
+    if (calibrations.remove(sensors[0], removed))
+    {
+      Serial.print(removed.gain[0]);
+      Serial.println("\tWAS REMOVED");
+    }
+
+    // Values are mutable in place, keys are not.
+    for (size_t i = 0; i < calibrations.size(); i++)
+    {
+      calibrations.value_at(i).offset[0] = -.25f * calibrations.key_at(i);
+    }
+    print_map();
+
+    calibrations.clear();
+    index = 0;
+    if (!calibrations.remove(3, removed))
+    {
+      Serial.println("KEY NOT FOUND OR MAP IS EMPTY");
+    }
+  }
+  else
+  {
+    if (!calibrations.emplace(sensors[index], gains[index]))
+    {
+      Serial.println("KEY DUPLICATION DETECTED");
+    }
+    print_map();
+
+    Calibration current{ };
+    if (calibrations.try_get(sensors[index], current))
+    {
+      Serial.print("Current Gain:\t");
+      Serial.println(current.gain[0]);
+    }
+    index++;
+  }
+
+  led_state ^= HIGH;
+  digitalWrite(LED_BUILTIN, led_state);
+  delay(2000);
+}
+
+void print_map() {
+  for (size_t i = 0; i < calibrations.size(); i++)
+  {
+    // Uncomment to check assignment. Keys should be const
+    // and the following line should not compile.
+    // calibrations.key_at(i) = 0;
+
+    Serial.print('<');
+    Serial.print(calibrations.key_at(i));
+    Serial.print(", ");
+    Serial.print(calibrations.value_at(i).gain[0]);
+    Serial.print(", ");
+    Serial.print(calibrations.value_at(i).offset[0]);
+    Serial.print(">, ");
+  }
+  Serial.print('\t');
+  Serial.println(calibrations.size());
+}
@@ -0,0 +1,322 @@
+/*
+ ******************************************************************************
+ *  ConstHashMap.hpp
+ *
+ *  Compile-time, perfect-hash Map for constant key sets.
+ *
+ *  Author: Pierre DEBAS
+ *  Copyright (c) 2026
+ *
+ *  MIT License
+ *  https://github.com/Pierrolefou881/DuinoCollections
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Description:
+ *    Read-only Map built at compile time from a constant list of key / value
+ *    pairs. The table is a minimal perfect hash: no RAM, no setup and O(1)
+ *    lookups. Part of the DuinoCollections library.
+ *
+ *    Building the table requires C++14 constexpr. Cores still compiling
+ *    with -std=gnu++11 (AVR by default) must switch to -std=gnu++14,
+ *    otherwise ConstHashMap is not available.
+ *
+ *    ex:
+ *      constexpr ConstKeyValue<uint8_t, Handler> COMMAND_LIST[]{
+ *          { 0x01, &ping }, { 0x10, &reset }, { 0x22, &status }
+ *      };
+ *      constexpr auto COMMANDS PROGMEM = make_const_hash_map(COMMAND_LIST);
+ *
+ ******************************************************************************
+ */
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include "Hashing.hpp"
+#include "internal/utils/Flash.hpp"
+
+#if __cplusplus >= 201402L
+
+namespace DuinoCollections
+{
+    /**
+     * Key / value pair used to build a ConstHashMap.
+     * @param K type of key, see ConstHashMap.
+     * @param V type of value, see ConstHashMap.
+     */
+    template<typename K, typename V>
+    struct ConstKeyValue
+    {
+        K key;
+        V value;
+    };
+
+    namespace Internal
+    {
+        /**
+         * Not constexpr on purpose: reaching it while building a ConstHashMap
+         * stops compilation. Two keys are equal or have equal hashes, or the
+         * keys of a bucket could not be placed within MAX_DISPLACEMENT tries.
+         */
+        inline void const_hash_map_duplicate_key_or_hash(void)
+        {
+            // Empty body.
+        }
+    }
+
+    /**
+     * Read-only collection of values indexed by a unique key, built at compile
+     * time with a "hash and displace" minimal perfect hash: every key has its
+     * own slot, found with one hash, one displacement read and one key
+     * comparison. No RAM is used when declared PROGMEM (AVR) or const (other
+     * targets, where constants stay in flash).
+     *
+     * Keys are spread over N buckets. Buckets are placed from the largest,
+     * each one gets the first displacement sending all its keys to free slots.
+     * A lookup hashes the key, reads the displacement of its bucket and
+     * derives the slot from both.
+     *
+     * Use try_get / contains for a map in RAM, try_get_P / contains_P for a
+     * map declared PROGMEM. They are identical on targets other than AVR.
+     * @param K type of key. Literal, trivially copyable type implementing
+     *        equality operators == and != (integral, enum...).
+     * @param V type of value. Literal, trivially copyable type with a
+     *        default initializer (integral, enum, function pointer...).
+     * @param N number of keys. Strictly positive.
+     * @param Hash constexpr functor returning a size_t hash for a const K&.
+     *        Different keys must have different hashes. Defaulted to
+     *        IntegralHash<K>.
+     */
+    template<typename K, typename V, size_t N, typename Hash = IntegralHash<K>>
+    class ConstHashMap
+    {
+        static_assert(N > 0, "ConstHashMap needs at least one key");
+
+    public:
+        // Displacements tried per bucket before giving up.
+        static const uint16_t MAX_DISPLACEMENT{ 0xFFFF };
+
+        /**
+         * Builds this ConstHashMap from the provided pairs. Meant to be
+         * evaluated at compile time: compilation fails if two keys are equal
+         * or have equal hashes. Evaluated at runtime, the map is left empty
+         * instead (every lookup fails).
+         * @param entries key / value pairs, keys must be unique.
+         */
+        constexpr explicit ConstHashMap(const ConstKeyValue<K, V> (&entries)[N])
+            : _displacements{ }, _keys{ }, _values{ }
+        {
+            size_t hashes[N]{ };
+            for (size_t i = 0; i < N; i++)
+            {
+                hashes[i] = Hash{ }(entries[i].key);
+            }
+
+            // No displacement can separate equal hashes: reject them up front.
+            for (size_t i = 1; i < N; i++)
+            {
+                for (size_t j = 0; j < i; j++)
+                {
+                    if (entries[i].key == entries[j].key || hashes[i] == hashes[j])
+                    {
+                        Internal::const_hash_map_duplicate_key_or_hash();
+                        return;
+                    }
+                }
+            }
+
+            size_t bucket_sizes[N]{ };
+            size_t order[N]{ };
+            for (size_t i = 0; i < N; i++)
+            {
+                bucket_sizes[bucket_of(hashes[i])]++;
+                order[i] = i;
+            }
+
+            // Largest buckets first: they are the hardest to place.
+            for (size_t i = 1; i < N; i++)
+            {
+                for (size_t j = i; j > 0 && bucket_sizes[order[j - 1]] < bucket_sizes[order[j]]; j--)
+                {
+                    auto swapped = order[j];
+                    order[j] = order[j - 1];
+                    order[j - 1] = swapped;
+                }
+            }
+
+            bool used[N]{ };
+            for (size_t i = 0; i < N && bucket_sizes[order[i]] > 0; i++)
+            {
+                auto bucket = order[i];
+                uint16_t displacement = 0;
+                while (!try_place(entries, hashes, used, bucket, displacement))
+                {
+                    if (displacement == MAX_DISPLACEMENT)
+                    {
+                        Internal::const_hash_map_duplicate_key_or_hash();
+                        return;
+                    }
+                    displacement++;
+                }
+                _displacements[bucket] = displacement;
+            }
+            _is_built = true;
+        }
+
+        /**
+         * Fetches the value indexed by the provided key. This ConstHashMap
+         * must be in RAM, see try_get_P otherwise.
+         * @param key indexing the item to find.
+         * @param out_val item, if found (out parameter).
+         * @return true if item found, false otherwise.
+         */
+        bool try_get(const K& key, V& out_val) const
+        {
+            auto slot = slot_of_key(key, _displacements[bucket_of(Hash{ }(key))]);
+            bool is_found = _is_built && _keys[slot] == key;
+            if (is_found)
+            {
+                out_val = _values[slot];
+            }
+            return is_found;
+        }
+
+        /**
+         * Fetches the value indexed by the provided key from a ConstHashMap
+         * declared PROGMEM.
+         * @param key indexing the item to find.
+         * @param out_val item, if found (out parameter).
+         * @return true if item found, false otherwise.
+         */
+        bool try_get_P(const K& key, V& out_val) const
+        {
+            auto slot = slot_of_key(key, Internal::Utils::read_flash(&_displacements[bucket_of(Hash{ }(key))]));
+            bool is_found = Internal::Utils::read_flash(&_is_built) && Internal::Utils::read_flash(&_keys[slot]) == key;
+            if (is_found)
+            {
+                out_val = Internal::Utils::read_flash(&_values[slot]);
+            }
+            return is_found;
+        }
+
+        /**
+         * Determines whether a key is present in this ConstHashMap. This
+         * ConstHashMap must be in RAM, see contains_P otherwise.
+         * @param key to check the presence of.
+         * @return true if key present, false otherwise.
+         */
+        [[nodiscard]]
+        bool contains(const K& key) const
+        {
+            return _is_built && _keys[slot_of_key(key, _displacements[bucket_of(Hash{ }(key))])] == key;
+        }
+
+        /**
+         * Determines whether a key is present in a ConstHashMap declared PROGMEM.
+         * @param key to check the presence of.
+         * @return true if key present, false otherwise.
+         */
+        [[nodiscard]]
+        bool contains_P(const K& key) const
+        {
+            auto slot = slot_of_key(key, Internal::Utils::read_flash(&_displacements[bucket_of(Hash{ }(key))]));
+            return Internal::Utils::read_flash(&_is_built) && Internal::Utils::read_flash(&_keys[slot]) == key;
+        }
+
+        /**
+         * @return the number of keys in this ConstHashMap.
+         */
+        static constexpr size_t size(void)
+        {
+            return N;
+        }
+
+    private:
+        static constexpr size_t bucket_of(size_t hash)
+        {
+            return hash % N;
+        }
+
+        // Rehashes hash with the displacement of its bucket.
+        static constexpr size_t slot_of(size_t hash, uint16_t displacement)
+        {
+            return IntegralHash<size_t>{ }(hash ^ (displacement * static_cast<size_t>(0x9E3779B9UL))) % N;
+        }
+
+        static size_t slot_of_key(const K& key, uint16_t displacement)
+        {
+            return slot_of(Hash{ }(key), displacement);
+        }
+
+        // Places every key of bucket with displacement if they all land on
+        // free and distinct slots, leaves used untouched otherwise.
+        constexpr bool try_place(const ConstKeyValue<K, V> (&entries)[N], const size_t (&hashes)[N],
+            bool (&used)[N], size_t bucket, uint16_t displacement)
+        {
+            size_t placed[N]{ };
+            size_t count = 0;
+            for (size_t i = 0; i < N; i++)
+            {
+                if (bucket_of(hashes[i]) != bucket)
+                {
+                    continue;
+                }
+
+                auto slot = slot_of(hashes[i], displacement);
+                if (used[slot])
+                {
+                    for (size_t j = 0; j < count; j++)
+                    {
+                        used[placed[j]] = false;
+                    }
+                    return false;
+                }
+
+                used[slot] = true;
+                placed[count++] = slot;
+                _keys[slot] = entries[i].key;
+                _values[slot] = entries[i].value;
+            }
+
+            return true;
+        }
+
+        uint16_t _displacements[N];
+        K _keys[N];
+        V _values[N];
+        // False if building failed at runtime: default keys must not match.
+        bool _is_built{ false };
+    };
+
+    /**
+     * Builds a ConstHashMap from the provided pairs, deducing key and value
+     * types and number of keys.
+     *
+     * example:
+     *      constexpr ConstKeyValue<uint8_t, uint8_t> PINS[]{ { 1, 13 }, { 2, 12 } };
+     *      constexpr auto PIN_MAP = make_const_hash_map(PINS);
+     *
+     * @param entries key / value pairs, keys must be unique.
+     * @return the ConstHashMap holding entries.
+     */
+    template<typename K, typename V, size_t N>
+    constexpr ConstHashMap<K, V, N> make_const_hash_map(const ConstKeyValue<K, V> (&entries)[N])
+    {
+        return ConstHashMap<K, V, N>{ entries };
+    }
+
+    /**
+     * Builds a ConstHashMap with a custom hash from the provided pairs, see
+     * make_const_hash_map(entries).
+     * @param Hash constexpr functor returning a size_t hash for a const K&.
+     * @param entries key / value pairs, keys must be unique.
+     * @return the ConstHashMap holding entries.
+     */
+    template<typename Hash, typename K, typename V, size_t N>
+    constexpr ConstHashMap<K, V, N, Hash> make_const_hash_map(const ConstKeyValue<K, V> (&entries)[N])
+    {
+        return ConstHashMap<K, V, N, Hash>{ entries };
+    }
+}
+
+#endif
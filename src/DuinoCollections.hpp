@@ -19,9 +19,14 @@
  ******************************************************************************
  */
 #pragma once
+#include "IndexRange.hpp"
 #include "FixedVector.hpp"
 #include "FixedSet.hpp"
+#include "FixedHashSet.hpp"
 #include "FixedOrderedVector.hpp"
 #include "FixedOrderedSet.hpp"
 #include "FixedMap.hpp"
+#include "FixedSplitMap.hpp"
+#include "FixedHashMap.hpp"
+#include "ConstHashMap.hpp"
 #include "FixedRingBuffer.hpp"
\ No newline at end of file
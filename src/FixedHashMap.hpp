@@ -0,0 +1,513 @@
+/*
+ ******************************************************************************
+ *  FixedHashMap.hpp
+ *
+ *  Fixed-size, hash-indexed Map implementation for the Arduino environment.
+ *
+ *  Author: Pierre DEBAS
+ *  Copyright (c) 2026
+ *
+ *  MIT License
+ *  https://github.com/Pierrolefou881/DuinoCollections
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Description:
+ *    Fixed-size Map implementation based on Robin Hood hashing for
+ *    Arduino-compatible boards. Part of the DuinoCollections library.
+ *
+ ******************************************************************************
+ */
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "KeyValue.hpp"
+#include "Hashing.hpp"
+#include "internal/utils/TypeTraits.hpp"
+#include "internal/utils/Memory.hpp"
+#include "internal/utils/HashTable.hpp"
+#include "internal/policy/storage/StoragePolicy.hpp"
+
+namespace DuinoCollections
+{
+    /**
+     * Fixed-size collection of values indexed by a unique key, stored in an
+     * open-addressing hash table with Robin Hood hashing.
+     * add, try_get and remove run in O(1) expected time and never shift the
+     * whole collection, unlike FixedMap. Keys are not ordered.
+     *
+     * Each bucket records the probe length of its entry (distance to its home
+     * bucket, plus one). Insertion places an entry before the first one that is
+     * closer to home, which keeps probe lengths short and even. Lookups stop
+     * as soon as they reach an entry closer to home than the key would be.
+     * Deletion shifts the following entries back (no tombstone).
+     *
+     * Probe lengths are bounded by MAX_PROBE_LENGTH: an add that would exceed
+     * it fails, like an add on a full FixedHashMap. With a reasonable load
+     * factor and hash, this never happens in practice.
+     * @param K type of key. Must implement equality operators == and !=.
+     * @param V type of value. Any movable type.
+     * @param Hash functor returning a size_t hash for a const K&. Equal keys
+     *        must have equal hashes. Defaulted to IntegralHash<K>.
+     * @param Capacity if not 0, entries are stored inline (no heap allocation)
+     *        and the capacity is fixed at compile time. Defaulted to 0:
+     *        capacity is provided at construction.
+     * @param MaxLoadPercent maximum ratio of used buckets, in ]0, 100[.
+     *        The table gets enough buckets to hold capacity entries under
+     *        this load. Lower values trade RAM for shorter probes.
+     *        Defaulted to 80.
+     */
+    template<typename K, typename V, typename Hash = IntegralHash<K>, size_t Capacity = 0,
+        uint8_t MaxLoadPercent = 80>
+    class FixedHashMap
+    {
+        static_assert(MaxLoadPercent > 0 && MaxLoadPercent < 100, "MaxLoadPercent must be in ]0, 100[");
+
+    public:
+        // Longest probe sequence an entry may have, in buckets.
+        static const uint8_t MAX_PROBE_LENGTH{ 255 };
+
+        /**
+         * Initializes this FixedHashMap with the provided maximum capacity.
+         * If none is provided, it shall be defaulted to 5.
+         * @param max_capacity maximum number of KeyValues this FixedHashMap can
+         *        contain. Defaulted to 5. Ignored if Capacity is not 0.
+         */
+        explicit FixedHashMap(size_t max_capacity = Capacity > 0 ? Capacity : 5)
+            : _entries{ bucket_count_for(max_capacity) }
+            , _probes{ bucket_count_for(max_capacity) }
+            , _capacity{ Capacity > 0 ? Capacity : max_capacity }
+        {
+            reset_probes();
+        }
+
+        ~FixedHashMap(void)
+        {
+            clear();
+        }
+
+        // Forbid copy to avoid double free.
+        FixedHashMap(const FixedHashMap&) = delete;
+        FixedHashMap& operator=(const FixedHashMap&) = delete;
+
+        FixedHashMap(FixedHashMap&& other) noexcept
+            : _entries{ Internal::Utils::move(other._entries) }
+            , _probes{ Internal::Utils::move(other._probes) }
+            , _capacity{ other._capacity }
+            , _size{ other._size }
+        {
+            take_entries(other);
+        }
+
+        FixedHashMap& operator=(FixedHashMap&& other) noexcept
+        {
+            if (this != &other)
+            {
+                clear();
+                _entries = Internal::Utils::move(other._entries);
+                _probes = Internal::Utils::move(other._probes);
+                _capacity = other._capacity;
+                _size = other._size;
+                take_entries(other);
+            }
+            return *this;
+        }
+
+        /**
+         * Adds the provided item and indexes it with the provided key.
+         * Add may fail if this FixedHashMap is already at full capacity
+         * (size == max capacity), if key already in use or if the probe
+         * sequence of key would exceed MAX_PROBE_LENGTH.
+         * @param key must be unique, i.e. not already in use.
+         * @param value can be any value supported by the type V.
+         * @return true if add was successful, false otherwise.
+         */
+        bool add(const K& key, const V& value)
+        {
+            return insert_entry(key, value);
+        }
+
+        /**
+         * Moves the provided value into this FixedHashMap and indexes it with
+         * the provided key, see add(const K&, const V&). value is left
+         * untouched on failure.
+         * @param key must be unique, i.e. not already in use.
+         * @param value to move into this FixedHashMap.
+         * @return true if add was successful, false otherwise.
+         */
+        bool add(const K& key, V&& value)
+        {
+            return insert_entry(key, Internal::Utils::move(value));
+        }
+
+        /**
+         * Builds a value in place from the provided arguments and indexes it
+         * with the provided key, see add(const K&, const V&). Nothing is
+         * built if emplace fails.
+         * @param key must be unique, i.e. not already in use.
+         * @param args arguments forwarded to the constructor of V.
+         * @return true if emplace was successful, false otherwise.
+         */
+        template<typename... Args>
+        bool emplace(const K& key, Args&&... args)
+        {
+            return insert_entry(key, Internal::Utils::forward<Args>(args)...);
+        }
+
+        /**
+         * Removes the item indexed by the provided key from this FixedHashMap
+         * and frees the key. Removal may fail if this FixedHashMap is empty
+         * or if key is not used.
+         * @param key indexing the item to remove.
+         * @param out_val value removed and moved out of this FixedHashMap, if
+         *        found (out parameter).
+         * @return true if removal was successful, false otherwise.
+         */
+        bool remove(const K& key, V& out_val)
+        {
+            auto bucket = find_bucket(key);
+            if (bucket == bucket_count())
+            {
+                return false;
+            }
+
+            auto entries = _entries.data();
+            auto probes = _probes.data();
+            out_val = Internal::Utils::move(entries[bucket].value);
+            Internal::Utils::destroy_at(entries + bucket);
+
+            // Backward shift: pull the following entries one bucket closer to
+            // home until a free bucket or an entry already at home.
+            auto next = (bucket + 1) & mask();
+            while (probes[next] > HOME)
+            {
+                Internal::Utils::relocate_elements(entries + bucket, entries + next, 1);
+                probes[bucket] = probes[next] - 1;
+                bucket = next;
+                next = (next + 1) & mask();
+            }
+
+            probes[bucket] = EMPTY;
+            _size--;
+            return true;
+        }
+
+        /**
+         * Fetches the value indexed by the provided key without removing it
+         * from this FixedHashMap.
+         * @param key indexing the item to find.
+         * @param out_val item, if found (out parameter).
+         * @return true if item found, false otherwise.
+         */
+        bool try_get(const K& key, V& out_val) const
+        {
+            auto bucket = find_bucket(key);
+            bool is_found = bucket != bucket_count();
+            if (is_found)
+            {
+                out_val = _entries.data()[bucket].value;
+            }
+            return is_found;
+        }
+
+        /**
+         * Determines whether a key is in use in this FixedHashMap.
+         * @param key to check the presence of.
+         * @return true if key present, false otherwise.
+         */
+        [[nodiscard]]
+        bool contains(const K& key) const
+        {
+            return find_bucket(key) != bucket_count();
+        }
+
+        /**
+         * Removes all items from this FixedHashMap. Every item is destroyed,
+         * memory is not actually freed.
+         */
+        void clear(void)
+        {
+            if (!is_valid())
+            {
+                return;
+            }
+
+            auto probes = _probes.data();
+            for (size_t bucket = 0; bucket < bucket_count(); bucket++)
+            {
+                if (probes[bucket] != EMPTY)
+                {
+                    Internal::Utils::destroy_at(_entries.data() + bucket);
+                }
+            }
+            reset_probes();
+            _size = 0;
+        }
+
+        /**
+         * @return true if the storage is usable, false otherwise.
+         *         Always true if the storage is inline.
+         */
+        [[nodiscard]]
+        bool is_valid(void) const
+        {
+            return _entries.is_valid() && _probes.is_valid();
+        }
+
+        /**
+         * @return the maximum number of KeyValues this FixedHashMap can contain.
+         */
+        [[nodiscard]]
+        size_t capacity(void) const
+        {
+            return is_valid() ? _capacity : 0;
+        }
+
+        /**
+         * @return the number of KeyValues contained in this FixedHashMap.
+         */
+        [[nodiscard]]
+        size_t size(void) const
+        {
+            return _size;
+        }
+
+        /**
+         * @return true if this FixedHashMap has reached its max capacity,
+         *         false otherwise.
+         */
+        [[nodiscard]]
+        bool is_full(void) const
+        {
+            return _size >= capacity();
+        }
+
+        /**
+         * @return true if this FixedHashMap contains no element, false otherwise.
+         */
+        [[nodiscard]]
+        bool is_empty(void) const
+        {
+            return _size == 0;
+        }
+
+        // ---------------------------------------------------------------------
+        // Iteration support (bucket order, not insertion order)
+        // ---------------------------------------------------------------------
+        /**
+         * Iterates over non-mutable KeyValues from a FixedHashMap, skipping
+         * free buckets.
+         */
+        class ConstHashMapIterator
+        {
+        public:
+            /**
+             * Initializes this ConstHashMapIterator on the first used bucket
+             * from the provided one.
+             * @param map must not be null.
+             * @param bucket to start from.
+             */
+            ConstHashMapIterator(const FixedHashMap* map, size_t bucket)
+                : _map{ map }, _bucket{ bucket }
+            {
+                skip_free_buckets();
+            }
+
+            const KeyValue<K, V>& operator*(void) const
+            {
+                return _map->_entries.data()[_bucket];
+            }
+
+            ConstHashMapIterator& operator++(void)
+            {
+                _bucket++;
+                skip_free_buckets();
+                return *this;
+            }
+
+            bool operator!=(const ConstHashMapIterator& other) const
+            {
+                return _map != other._map || _bucket != other._bucket;
+            }
+
+        private:
+            void skip_free_buckets(void)
+            {
+                while (_bucket < _map->bucket_count() && _map->_probes.data()[_bucket] == EMPTY)
+                {
+                    _bucket++;
+                }
+            }
+
+            const FixedHashMap* _map;
+            size_t _bucket;
+        };
+
+        ConstHashMapIterator begin() const
+        {
+            return { this, 0 };
+        }
+
+        ConstHashMapIterator end() const
+        {
+            return { this, bucket_count() };
+        }
+
+        ConstHashMapIterator cbegin() const
+        {
+            return begin();
+        }
+
+        ConstHashMapIterator cend() const
+        {
+            return end();
+        }
+
+    private:
+        // Probe lengths: 0 marks a free bucket, 1 an entry in its home bucket.
+        static const uint8_t EMPTY{ 0 };
+        static const uint8_t HOME{ 1 };
+
+        static constexpr size_t INLINE_BUCKETS{
+            Capacity > 0 ? Internal::Utils::hash_table_capacity(Capacity, MaxLoadPercent) : 0 };
+        static_assert(Capacity == 0 || INLINE_BUCKETS > 0, "Capacity too large for a hash table");
+
+        static size_t bucket_count_for(size_t max_capacity)
+        {
+            return Capacity > 0 ? INLINE_BUCKETS : Internal::Utils::hash_table_capacity(max_capacity, MaxLoadPercent);
+        }
+
+        size_t bucket_count(void) const
+        {
+            return _probes.capacity();
+        }
+
+        // Bucket counts are powers of two, buckets wrap with a mask.
+        size_t mask(void) const
+        {
+            return bucket_count() - 1;
+        }
+
+        size_t home_bucket(const K& key) const
+        {
+            return Hash{ }(key) & mask();
+        }
+
+        // Returns the bucket holding key, or bucket_count() if absent.
+        size_t find_bucket(const K& key) const
+        {
+            if (!is_valid() || is_empty())
+            {
+                return bucket_count();
+            }
+
+            auto entries = _entries.data();
+            auto probes = _probes.data();
+            auto bucket = home_bucket(key);
+            // Entries are sorted by home bucket along a cluster: once an entry
+            // is closer to home than key would be, key is not in the table.
+            for (size_t probe = HOME; probes[bucket] >= probe; probe++)
+            {
+                if (probes[bucket] == probe && entries[bucket].key == key)
+                {
+                    return bucket;
+                }
+                bucket = (bucket + 1) & mask();
+            }
+
+            return bucket_count();
+        }
+
+        // Constructs a KeyValue from key and args (value to copy or move)
+        // before the first entry closer to home, shifting the rest of the
+        // cluster one bucket forward.
+        template<typename... Args>
+        bool insert_entry(const K& key, Args&&... args)
+        {
+            if (!is_valid() || is_full())
+            {
+                return false;
+            }
+
+            auto entries = _entries.data();
+            auto probes = _probes.data();
+            auto bucket = home_bucket(key);
+            size_t probe = HOME;
+            for (; probes[bucket] >= probe; probe++)
+            {
+                if (probes[bucket] == probe && entries[bucket].key == key)
+                {
+                    return false;
+                }
+                bucket = (bucket + 1) & mask();
+            }
+
+            if (probe > MAX_PROBE_LENGTH)
+            {
+                return false;
+            }
+
+            // Shifted entries get one bucket further from home.
+            auto last = bucket;
+            while (probes[last] != EMPTY)
+            {
+                if (probes[last] == MAX_PROBE_LENGTH)
+                {
+                    return false;
+                }
+                last = (last + 1) & mask();
+            }
+
+            while (last != bucket)
+            {
+                auto previous = (last - 1) & mask();
+                Internal::Utils::relocate_elements(entries + last, entries + previous, 1);
+                probes[last] = probes[previous] + 1;
+                last = previous;
+            }
+
+            Internal::Utils::construct_at(entries + bucket, key, Internal::Utils::forward<Args>(args)...);
+            probes[bucket] = static_cast<uint8_t>(probe);
+            _size++;
+            return true;
+        }
+
+        void reset_probes(void)
+        {
+            if (_probes.is_valid())
+            {
+                memset(_probes.data(), EMPTY, bucket_count());
+            }
+        }
+
+        // Completes a move from other once storages and size are transferred.
+        // Heap storage hands its arrays over, inline storage cannot: live
+        // entries are relocated to the same buckets of this FixedHashMap.
+        void take_entries(FixedHashMap& other)
+        {
+            if (Entries::IS_INLINE)
+            {
+                auto probes = other._probes.data();
+                for (size_t bucket = 0; bucket < bucket_count(); bucket++)
+                {
+                    if (probes[bucket] != EMPTY)
+                    {
+                        Internal::Utils::relocate_elements(_entries.data() + bucket, other._entries.data() + bucket, 1);
+                    }
+                }
+                Internal::Utils::copy_elements(_probes.data(), probes, bucket_count());
+                other.reset_probes();
+            }
+            other._size = 0;
+        }
+
+        using Entries = Internal::Policy::Storage::StoragePolicy<KeyValue<K, V>, INLINE_BUCKETS>;
+        using Probes = Internal::Policy::Storage::StoragePolicy<uint8_t, INLINE_BUCKETS>;
+
+        Entries _entries;
+        Probes _probes;
+        size_t _capacity{ };
+        size_t _size{ };
+    };
+}
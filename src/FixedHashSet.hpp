@@ -0,0 +1,115 @@
+/*
+ ******************************************************************************
+ *  FixedHashSet.hpp
+ *
+ *  Fixed-size, hash-indexed Set implementation for the Arduino environment.
+ *
+ *  Author: Pierre DEBAS
+ *  Copyright (c) 2026
+ *
+ *  MIT License
+ *  https://github.com/Pierrolefou881/DuinoCollections
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Description:
+ *    Fixed-size, array-backed Set implementation with hashed lookups for
+ *    Arduino compatible boards. Part of the DuinoCollections library.
+ *
+ ******************************************************************************
+ */
+#pragma once
+#include "internal/LinearCollection.hpp"
+#include "Hashing.hpp"
+#include "internal/policy/indexing/HashIndexingPolicy.hpp"
+#include "internal/policy/duplication/DuplicationPolicy.hpp"
+
+namespace DuinoCollections
+{
+    /**
+     * Fixed-size, non-ordered container that does not allow duplicates.
+     * Unlike FixedSet, insert, contains, find and erase run in O(1)
+     * expected time through a hash table, at the cost of extra RAM
+     * (2.5 to 4 index entries per element of capacity, see "Index memory"
+     * in HashIndexingPolicy for the entry type).
+     * Elements can be accessed through their index, but not modified.
+     * Removals move the last element into the freed index.
+     * @param T type of element. Can be any movable type as long as it
+     *        implements equality operators == and !=.
+     * @param Hash functor returning a size_t hash for a const T&. Equal
+     *        elements must have equal hashes. Defaulted to IntegralHash<T>.
+     * @param Capacity if not 0, elements and hash table are stored inline
+     *        (no heap allocation) and the capacity is fixed at compile time.
+     *        Defaulted to 0: capacity is provided at construction.
+     */
+    template<typename T, typename Hash = IntegralHash<T>, size_t Capacity = 0>
+    class FixedHashSet : public Internal::LinearCollection<
+        T, Internal::Policy::Indexing::HashIndexingPolicy<T, Hash, Capacity>,
+        Internal::Policy::Duplication::DuplicationPolicy::FORBID_DUPLICATES,
+        Capacity
+    >
+    {
+        using Base = Internal::LinearCollection<
+            T, Internal::Policy::Indexing::HashIndexingPolicy<T, Hash, Capacity>,
+            Internal::Policy::Duplication::DuplicationPolicy::FORBID_DUPLICATES,
+            Capacity
+        >;
+
+    public:
+        /**
+         * Initializes this FixedHashSet with the provided maximum capacity.
+         * If no capacity is provided, it shall be defaulted to 5.
+         * @param max_capacity number of elements this FixedHashSet can contain at most.
+         *        Defaulted to 5. Ignored if Capacity is not 0.
+         */
+        FixedHashSet(size_t max_capacity = Capacity > 0 ? Capacity : 5) : Base{ max_capacity }
+        {
+            // Empty body.
+        }
+
+        /**
+         * Inserts the provided item into this FixedHashSet. Insertion may fail if
+         * the collection is already at full capacity or if item is already contained
+         * in this FixedHashSet.
+         * @param item to insert.
+         * @return true if insertion was successful, false otherwise.
+         */
+        bool insert(const T& item)
+        {
+            return Base::push(item);
+        }
+
+        /**
+         * Moves the provided item into this FixedHashSet, see insert(const T&).
+         * @param item to insert.
+         * @return true if insertion was successful, false otherwise.
+         */
+        bool insert(T&& item)
+        {
+            return Base::push(Internal::Utils::move(item));
+        }
+
+        /**
+         * Builds an item from the provided arguments and inserts it into this
+         * FixedHashSet, see insert(const T&).
+         * @param args arguments forwarded to the constructor of T.
+         * @return true if insertion was successful, false otherwise.
+         */
+        template<typename... Args>
+        bool emplace(Args&&... args)
+        {
+            return Base::emplace(Internal::Utils::forward<Args>(args)...);
+        }
+
+        /**
+         * Removes item from this FixedHashSet. Removal may fail if the collection
+         * is empty (i.e. contains no element) or if item is not present.
+         * @param item to remove.
+         * @return true if item was removed successfully, false otherwise.
+         */
+        bool erase(const T& item)
+        {
+            return Base::remove_first(item);
+        }
+    };
+}
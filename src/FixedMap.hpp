@@ -20,118 +20,375 @@
  */
 #pragma once
 #include "internal/LinearCollection.hpp"
+#include "KeyValue.hpp"
 #include "SortingOrder.hpp"
+#include "SearchStrategy.hpp"
+#include "IndexRange.hpp"
 #include "internal/policy/indexing/OrderedIndexingPolicy.hpp"
 #include "internal/policy/duplication/DuplicationPolicy.hpp"
+#include "internal/utils/Eytzinger.hpp"
 
 namespace DuinoCollections
 {
     /**
-     * Data element to be used in FixedMap, associates a unique, comparable
-     * key with a value.
+     * Fixed-size collection of values indexed by a unique key.
+     * The FixedMap is sequential, ordered and does not allow duplicate
+     * keys (duplicates values are allowed). The association is represented by
+     * the struct KeyValue.
+     *
+     * A read-mostly FixedMap can be frozen (see freeze()): entries are
+     * rearranged in Eytzinger layout for faster lookups, and sorted back by
+     * the next insertion or removal.
      * @param K type of key. Must have a default initializer and must
      *        implement equality operators == and != and comparison
      *        operators <, <=, >, >=. Usually integral (int, uint, size_t...).
-     * @param V type of value. Must implement a default initializer.
+     * @param V type of value. Any movable type, lookups and removals
+     *        never build a V.
+     * @param Capacity if not 0, KeyValues are stored inline (no heap
+     *        allocation) and the capacity is fixed at compile time.
+     *        Defaulted to 0: capacity is provided at construction.
+     * @param Search lower bound kernel used by key lookups and insertions,
+     *        see SearchStrategy.hpp. Defaulted to BinarySearch.
      */
-    template<typename K, typename V>
-    struct KeyValue
+    template<typename K, typename V, size_t Capacity = 0, typename Search = BinarySearch>
+    class FixedMap : public Internal::LinearCollection<KeyValue<K, V>,
+        Internal::Policy::Indexing::OrderedIndexingPolicy<KeyValue<K, V>, Ascending<KeyValue<K, V>>, Search>,
+        Internal::Policy::Duplication::DuplicationPolicy::FORBID_DUPLICATES,
+        Capacity
+    >
     {
-        K key{ };
-        V value{ };
+        using Base = Internal::LinearCollection<KeyValue<K, V>, 
+            Internal::Policy::Indexing::OrderedIndexingPolicy<KeyValue<K, V>, Ascending<KeyValue<K, V>>, Search>,
+            Internal::Policy::Duplication::DuplicationPolicy::FORBID_DUPLICATES,
+            Capacity
+        >;
+    
+    public:
+        /**
+         * Initializes this FixedMap with the provided maximum capacity.
+         * If no capacity if provided, it shall be defaulted to 5.
+         * @param max_capacity maximum number of KeyValues this FixedMap can
+         *        contain. Defaulted to 5. Ignored if Capacity is not 0.
+         */
+        FixedMap(size_t max_capacity = Capacity > 0 ? Capacity : 5) : Base{ max_capacity }
+        {
+            // Empty body.
+        }
 
         /**
-         * Initializes this KeyValue as a default one.
+         * Adds the provided item and indexes it with the provided key.
+         * Add may fail if this FixedMap is already at full capacity
+         * (size == max capacity) or if key already in use.
+         * @param key must be unique, i.e. not already in use.
+         * @param value can be any value supported by the type V.
+         * @return true if add was successful, false otherwise.
          */
-        KeyValue(void) = default;
+        bool add(const K& key, const V& value)
+        {
+            thaw();
+            return Base::push(KeyValue<K, V>{ key, value });
+        }
 
         /**
-         * Initializes this KeyValue with the provided
-         * key and value.
-         * @param a_key must be unique.
-         * @param a_value can be any value of its type.
+         * Moves the provided value into this FixedMap and indexes it with
+         * the provided key, see add(const K&, const V&).
+         * @param key must be unique, i.e. not already in use.
+         * @param value to move into this FixedMap.
+         * @return true if add was successful, false otherwise.
          */
-        explicit KeyValue(const K& a_key, const V& a_value)
-            : key{ a_key }, value{ a_value}
+        bool add(const K& key, V&& value)
         {
-            // Empty body.
+            thaw();
+            return Base::push(KeyValue<K, V>{ key, Internal::Utils::move(value) });
         }
 
-        friend bool operator ==(const KeyValue<K, V>& a, const KeyValue<K, V>& b)
+        /**
+         * Adds the provided item at the hinted index, without any search if
+         * key belongs there (e.g. hint == size() for increasing keys), see
+         * add(const K&, const V&). Any other hint falls back to a search.
+         * @param hint expected insertion index.
+         * @param key must be unique, i.e. not already in use.
+         * @param value can be any value supported by the type V.
+         * @return true if add was successful, false otherwise.
+         */
+        bool add(size_t hint, const K& key, const V& value)
         {
-            return a.key == b.key;
+            thaw();
+            return Base::push_hint(hint, KeyValue<K, V>{ key, value });
         }
 
-        friend bool operator !=(const KeyValue<K, V>& a, const KeyValue<K, V>& b)
+        /**
+         * Moves the provided value in at the hinted index, see
+         * add(size_t, const K&, const V&).
+         * @param hint expected insertion index.
+         * @param key must be unique, i.e. not already in use.
+         * @param value to move into this FixedMap.
+         * @return true if add was successful, false otherwise.
+         */
+        bool add(size_t hint, const K& key, V&& value)
         {
-            return !(a == b);
+            thaw();
+            return Base::push_hint(hint, KeyValue<K, V>{ key, Internal::Utils::move(value) });
         }
 
-        friend bool operator >(const KeyValue<K, V>& a, const KeyValue<K, V>& b)
+        /**
+         * Builds a value in place from the provided arguments and indexes it
+         * with the provided key, see add(const K&, const V&). Same as
+         * try_emplace.
+         * @param key must be unique, i.e. not already in use.
+         * @param args arguments forwarded to the constructor of V.
+         * @return true if emplace was successful, false otherwise.
+         */
+        template<typename... Args>
+        bool emplace(const K& key, Args&&... args)
         {
-            return a.key > b.key;
+            return try_emplace(key, Internal::Utils::forward<Args>(args)...);
         }
 
-        friend bool operator >=(const KeyValue<K, V>& a, const KeyValue<K, V>& b)
+        /**
+         * Builds a value in place from the provided arguments and indexes it
+         * with the provided key, if key is not in use. A single search is
+         * performed and no value is built if key is in use or if this
+         * FixedMap is full.
+         * @param key must be unique, i.e. not already in use.
+         * @param args arguments forwarded to the constructor of V.
+         * @return true if the value was added, false otherwise.
+         */
+        template<typename... Args>
+        bool try_emplace(const K& key, Args&&... args)
         {
-            return a > b || a == b;
+            if (Base::is_full())
+            {
+                return false;
+            }
+
+            thaw();
+            auto res = Base::find_key_position(key);
+            return !res.found && Base::emplace_at(res.index, key, Internal::Utils::forward<Args>(args)...);
         }
 
-        friend bool operator <(const KeyValue<K, V>& a, const KeyValue<K, V>& b)
+        /**
+         * Assigns the provided value to key if it is in use, adds it otherwise.
+         * A single search is performed.
+         * Fails only if key is not in use and this FixedMap is full.
+         * @param key indexing the value.
+         * @param value to assign or add.
+         * @return true if value was assigned or added, false otherwise.
+         */
+        bool insert_or_assign(const K& key, const V& value)
         {
-            return !(a >= b);
+            return upsert(key, value);
         }
 
-        friend bool operator <=(const KeyValue<K, V>& a, const KeyValue<K, V>& b)
+        /**
+         * Moves the provided value to key, see insert_or_assign(const K&, const V&).
+         * value is left untouched on failure.
+         * @param key indexing the value.
+         * @param value to move into this FixedMap.
+         * @return true if value was assigned or added, false otherwise.
+         */
+        bool insert_or_assign(const K& key, V&& value)
         {
-            return !(a > b);
+            return upsert(key, Internal::Utils::move(value));
         }
-    };
 
-    /**
-     * Fixed-size collection of values indexed by a unique key.
-     * The FixedMap is sequential, ordered and does not allow duplicate
-     * keys (duplicates values are allowed). The association is represented by
-     * the struct KeyValue.
-     * @param K type of key. Must have a default initializer and must
-     *        implement equality operators == and != and comparison
-     *        operators <, <=, >, >=. Usually integral (int, uint, size_t...).
-     * @param V type of value. Must implement a default initializer.
-     */
-    template<typename K, typename V>
-    class FixedMap : public Internal::LinearCollection<KeyValue<K, V>,
-        Internal::Policy::Indexing::OrderedIndexingPolicy<KeyValue<K, V>, Ascending<KeyValue<K,V>>>,
-        Internal::Policy::Duplication::DuplicationPolicy::FORBID_DUPLICATES
-    >
-    {
-        using Base = Internal::LinearCollection<KeyValue<K, V>, 
-            Internal::Policy::Indexing::OrderedIndexingPolicy<KeyValue<K, V>, Ascending<KeyValue<K, V>>>,
-            Internal::Policy::Duplication::DuplicationPolicy::FORBID_DUPLICATES
-        >;
-    
-    public:
         /**
-         * Initializes this FixedMap with the provided maximum capacity.
-         * If no capacity if provided, it shall be defaulted to 5.
-         * @param max_capacity maximum number of KeyValues this FixedMap can
-         *        contain. Defaulted to 5.
+         * Inserts copies of the KeyValues of [first, last) in bulk: they are
+         * appended, sorted once, then those with a key already in use are
+         * dropped. O(n log n) overall instead of one search and shift per KeyValue, and
+         * no extra buffer. KeyValues that do not fit are not inserted.
+         * If the range holds equal keys, which one is kept is unspecified.
+         * @param first iterator to the first KeyValue to insert.
+         * @param last iterator past the last KeyValue to insert.
+         * @return the number of KeyValues inserted.
          */
-        FixedMap(size_t max_capacity = 5) : Base{ max_capacity }
+        template<typename Iterator>
+        size_t insert_range(Iterator first, Iterator last)
         {
-            // Empty body.
+            thaw();
+            return Base::insert_range(first, last);
         }
 
         /**
-         * Adds the provided item and indexes it with the provided key.
-         * Add may fail if this FixedMap is already at full capacity
-         * (size == max capacity) or if key already in use.
-         * @param key must be unique, i.e. not already in use.
-         * @param value can be any value supported by the type V.
-         * @return true if add was successful, false otherwise.
+         * Replaces the content of this FixedMap with copies of the KeyValues
+         * of [first, last), see insert_range.
+         * @param first iterator to the first KeyValue to insert.
+         * @param last iterator past the last KeyValue to insert.
+         * @return the number of KeyValues inserted.
          */
-        bool add(const K& key, const V& value)
+        template<typename Iterator>
+        size_t assign_range(Iterator first, Iterator last)
         {
-            return Base::push(KeyValue<K, V>{ key, value });
+            clear();
+            return Base::insert_range(first, last);
+        }
+
+        /**
+         * Gives in-place access to the value indexed by the provided key.
+         * CAUTION: the pointer is invalidated by any insertion or removal.
+         * @param key indexing the value.
+         * @return a pointer to the value, or nullptr if key is not in use.
+         */
+        V* get_ptr(const K& key)
+        {
+            auto index = find(key);
+            return index != Base::size() ? &Base::data()[index].value : nullptr;
+        }
+
+        /**
+         * Gives read-only access to the value indexed by the provided key,
+         * see get_ptr(const K&).
+         * @param key indexing the value.
+         * @return a pointer to the value, or nullptr if key is not in use.
+         */
+        const V* get_ptr(const K& key) const
+        {
+            auto index = find(key);
+            return index != Base::size() ? &Base::data()[index].value : nullptr;
+        }
+
+        /**
+         * Determines the index of the provided key, if any. The search
+         * compares key with stored KeyValues directly, no KeyValue (hence
+         * no V) is built. Searches the Eytzinger layout if this FixedMap is
+         * frozen.
+         * @param key to find in this FixedMap.
+         * @return the index of key, or size() if not found.
+         */
+        size_t find(const K& key) const
+        {
+            if (_is_frozen)
+            {
+                return Internal::Utils::eytzinger_find(Base::data(), Base::size(), key, Order{ });
+            }
+            return Base::find_key(key);
+        }
+
+        /**
+         * Determines the index of the key of the provided KeyValue, if any,
+         * see find(const K&).
+         * @param item KeyValue holding the key to find.
+         * @return the index of item.key, or size() if not found.
+         */
+        size_t find(const KeyValue<K, V>& item) const
+        {
+            return find(item.key);
+        }
+
+        /**
+         * Determines whether the key of the provided KeyValue is in use.
+         * @param item KeyValue holding the key to check the presence of.
+         * @return true if key present, false otherwise.
+         */
+        [[nodiscard]]
+        bool contains(const KeyValue<K, V>& item) const
+        {
+            return contains(item.key);
+        }
+
+        /**
+         * Determines whether a key is in use in this FixedMap.
+         * @param key to check the presence of.
+         * @return true if key present, false otherwise.
+         */
+        [[nodiscard]]
+        bool contains(const K& key) const
+        {
+            return find(key) != Base::size();
+        }
+
+        /**
+         * @param key to look up.
+         * @return the position, in sorting order, of the first entry not
+         *         coming before key: the number of entries before it.
+         *         Complexity: O(log n), O(log^2 n) if frozen.
+         */
+        size_t lower_bound(const K& key) const
+        {
+            if (_is_frozen)
+            {
+                return frozen_bound(key, Order{ });
+            }
+            return Base::lower_bound_key(key);
+        }
+
+        /**
+         * @param key to look up.
+         * @return the position, in sorting order, of the first entry coming
+         *         after key. Complexity: O(log n), O(log^2 n) if frozen.
+         */
+        size_t upper_bound(const K& key) const
+        {
+            if (_is_frozen)
+            {
+                return frozen_bound(key, UpperBound{ Order{ } });
+            }
+            return Base::upper_bound_key(key);
+        }
+
+        /**
+         * @param key to look up.
+         * @return the positions, in sorting order, of the entries equal to key.
+         */
+        IndexRange equal_range(const K& key) const
+        {
+            return { lower_bound(key), upper_bound(key) };
+        }
+
+        /**
+         * @param key to count.
+         * @return the number of entries equal to key, without any scan.
+         */
+        size_t count(const K& key) const
+        {
+            return contains(key) ? 1 : 0;
+        }
+
+        /**
+         * Locates the entries from lo (included) to hi (excluded) in sorting
+         * order, e.g. readings of a time window. Empty if hi comes before lo.
+         * @param lo first key of the range.
+         * @param hi key past the range.
+         * @return the positions, in sorting order, of the entries in [lo, hi).
+         */
+        IndexRange range(const K& lo, const K& hi) const
+        {
+            auto first = lower_bound(lo);
+            auto last = lower_bound(hi);
+            return { first, last > first ? last : first };
+        }
+
+        /**
+         * @param lo first key of the range.
+         * @param hi key past the range.
+         * @return the number of entries in [lo, hi), see range. Complexity: O(log n).
+         */
+        size_t count_in_range(const K& lo, const K& hi) const
+        {
+            return range(lo, hi).size();
+        }
+
+        /**
+         * @param key to rank, present or not.
+         * @return the number of entries coming before key, see lower_bound.
+         */
+        size_t rank(const K& key) const
+        {
+            return lower_bound(key);
+        }
+
+        /**
+         * Access the entry at the provided position in sorting order, e.g.
+         * the median with select(size() / 2). Positions are those returned
+         * by lower_bound, equal_range, range and rank.
+         * CAUTION: Undefined behavior if out of bounds. Always ensure
+         * position < size().
+         * @param position in sorting order.
+         * @return the reference to the entry at position.
+         */
+        const KeyValue<K, V>& select(size_t position) const
+        {
+            return Base::at(_is_frozen ? Internal::Utils::eytzinger_select(position, Base::size()) : position);
         }
 
         /**
@@ -139,21 +396,61 @@ namespace DuinoCollections
          * frees index. Removal may fail if this FixedMap has no element (i.e. is empty)
          * or if key is not used.
          * @param key indexing the item to remove.
-         * @param out_val value removed, if found; default otherwise (out parameter).
+         * @param out_val value removed and moved out of this FixedMap, if found
+         *        (out parameter).
          * @return true if removal was successful, false otherwise.
          */
         bool remove(const K& key, V& out_val)
         {
-            KeyValue<K, V> keyval{ key, V{ }};
-            auto index = Base::find(keyval);
+            auto index = find(key);
             if (index == Base::size())
             {
                 return false;
             }
 
-            Base::remove_at(index, keyval);
-            out_val = keyval.value;
-            return true;
+            out_val = Internal::Utils::move(Base::data()[index].value);
+            return Base::erase_at(thaw_at(index));
+        }
+
+        /**
+         * Removes every entry with a key from lo (included) to hi (excluded),
+         * e.g. expired timestamps, with two searches and a single block move
+         * of the following entries: O(n) at most. A frozen FixedMap stays
+         * frozen if no key is in the range.
+         * @param lo first key of the range.
+         * @param hi key past the range.
+         * @return the number of entries removed.
+         */
+        size_t erase_range(const K& lo, const K& hi)
+        {
+            if (_is_frozen && count_in_range(lo, hi) == 0)
+            {
+                return 0;
+            }
+            thaw();
+            return Base::erase_key_range(lo, hi);
+        }
+
+        /**
+         * Removes and moves out the KeyValue at the provided index, see
+         * LinearCollection::remove_at. If this FixedMap is frozen, index is
+         * a position in the frozen layout.
+         * @param index of the KeyValue to remove.
+         * @param out_item KeyValue removed (out parameter).
+         * @return true if removal successful, false otherwise.
+         */
+        bool remove_at(size_t index, KeyValue<K, V>& out_item)
+        {
+            return Base::remove_at(thaw_at(index), out_item);
+        }
+
+        /**
+         * Removes all KeyValues from this FixedMap, which is no longer frozen.
+         */
+        void clear(void)
+        {
+            Base::clear();
+            _is_frozen = false;
         }
 
         /**
@@ -163,9 +460,9 @@ namespace DuinoCollections
          * @param out_val item, if found (out parameter).
          * @return true if item found, false otherwise.
          */
-        bool try_get(const K& key, V& out_val)
+        bool try_get(const K& key, V& out_val) const
         {
-            auto index = Base::find(KeyValue<K, V>{ key, V{ } });
+            auto index = find(key);
             bool is_found = index != Base::size();
             if (is_found)
             {
@@ -173,5 +470,99 @@ namespace DuinoCollections
             }
             return is_found;
         }
+
+        /**
+         * Rearranges the entries in Eytzinger (breadth-first) layout, in place
+         * and without extra memory: key lookups then probe predictable,
+         * cache-friendly positions. Meant for maps written once and queried
+         * many times. Values can still be updated through get_ptr and
+         * insert_or_assign on existing keys.
+         *
+         * While frozen, operator[], at() and iteration follow the frozen
+         * layout, not the key order. Insertions and removals sort the entries
+         * back first, see thaw().
+         */
+        void freeze(void)
+        {
+            if (!_is_frozen && Base::is_valid())
+            {
+                Internal::Utils::to_eytzinger(Base::data(), Base::size());
+                _is_frozen = true;
+            }
+        }
+
+        /**
+         * Sorts back the entries of a frozen FixedMap. Does nothing if it is
+         * not frozen.
+         */
+        void thaw(void)
+        {
+            if (_is_frozen)
+            {
+                Internal::Utils::from_eytzinger(Base::data(), Base::size());
+                _is_frozen = false;
+            }
+        }
+
+        /**
+         * @return true if the entries are in frozen layout, false if sorted.
+         */
+        [[nodiscard]]
+        bool is_frozen(void) const
+        {
+            return _is_frozen;
+        }
+
+    private:
+        using Order = Ascending<KeyValue<K, V>>;
+        using UpperBound = Internal::Policy::Indexing::UpperBoundOrder<Order>;
+
+        // Sorted position of the frozen entry bounding key with order.
+        template<typename BoundOrder>
+        size_t frozen_bound(const K& key, const BoundOrder& order) const
+        {
+            auto slot = Internal::Utils::eytzinger_lower_bound(Base::data(), Base::size(), key, order);
+            return slot == Base::size() ? slot : Internal::Utils::eytzinger_rank(slot, Base::size());
+        }
+
+        // Assigns value (copied or moved) to key, or adds it at the position
+        // found by the same search. Assigning to an existing key keeps a
+        // frozen layout.
+        template<typename U>
+        bool upsert(const K& key, U&& value)
+        {
+            if (_is_frozen)
+            {
+                if (V* current = get_ptr(key))
+                {
+                    *current = Internal::Utils::forward<U>(value);
+                    return true;
+                }
+                thaw();
+            }
+
+            auto res = Base::find_key_position(key);
+            if (res.found)
+            {
+                Base::data()[res.index].value = Internal::Utils::forward<U>(value);
+                return true;
+            }
+
+            return Base::emplace_at(res.index, key, Internal::Utils::forward<U>(value));
+        }
+
+        // Sorts the entries back and returns the sorted position of the
+        // entry found at index in the frozen layout.
+        size_t thaw_at(size_t index)
+        {
+            if (_is_frozen && index < Base::size())
+            {
+                index = Internal::Utils::eytzinger_rank(index, Base::size());
+            }
+            thaw();
+            return index;
+        }
+
+        bool _is_frozen{ false };
     };
 }
\ No newline at end of file
@@ -19,10 +19,14 @@
  ******************************************************************************
  */
 #pragma once
+#include <stdint.h>
 #include "internal/LinearCollection.hpp"
 #include "SortingOrder.hpp"
+#include "SearchStrategy.hpp"
+#include "IndexRange.hpp"
 #include "internal/policy/indexing/OrderedIndexingPolicy.hpp"
 #include "internal/policy/duplication/DuplicationPolicy.hpp"
+#include "internal/utils/Eytzinger.hpp"
 
 namespace DuinoCollections
 {
@@ -30,31 +34,42 @@ namespace DuinoCollections
      * Ordered collection of items that does not allow duplicates.
      * FixedOrderedSet does not allow indexed insertion, popping
      * out (does not behave as a stack) and duplications.
-     * @param T can be any type as long as it implements a
-     *        default initializer, equality operators == and !=,
+     *
+     * A read-mostly FixedOrderedSet can be frozen (see freeze()): elements
+     * are rearranged in Eytzinger layout for faster lookups, and sorted back
+     * by the next modification.
+     * @param T can be any movable type as long as it implements
+     *        equality operators == and !=,
      *        and comparison operators <, <=, > and >=.
      * @param SortingOrder can be either ascending or descending.
      *        Defaulted to Ascending.
+     * @param Capacity if not 0, elements are stored inline (no heap
+     *        allocation) and the capacity is fixed at compile time.
+     *        Defaulted to 0: capacity is provided at construction.
+     * @param Search lower bound kernel used by lookups and insertions, see
+     *        SearchStrategy.hpp. Defaulted to BinarySearch.
      */
-    template<typename T, typename SortingOrder = Ascending<T>>
+    template<typename T, typename SortingOrder = Ascending<T>, size_t Capacity = 0, typename Search = BinarySearch>
     class FixedOrderedSet : public Internal::LinearCollection<
-        T, Internal::Policy::Indexing::OrderedIndexingPolicy<T, SortingOrder>, 
-        Internal::Policy::Duplication::DuplicationPolicy::FORBID_DUPLICATES
+        T, Internal::Policy::Indexing::OrderedIndexingPolicy<T, SortingOrder, Search>, 
+        Internal::Policy::Duplication::DuplicationPolicy::FORBID_DUPLICATES,
+        Capacity
     > 
     {
     public:
         using Base = Internal::LinearCollection<
-            T, Internal::Policy::Indexing::OrderedIndexingPolicy<T, SortingOrder>,
-            Internal::Policy::Duplication::DuplicationPolicy::FORBID_DUPLICATES
+            T, Internal::Policy::Indexing::OrderedIndexingPolicy<T, SortingOrder, Search>,
+            Internal::Policy::Duplication::DuplicationPolicy::FORBID_DUPLICATES,
+            Capacity
         >;
 
         /**
          * Initializes this FixedOrderedSet with the provided capacity.
          * If none is provided, it shall be defaulted to 5.
          * @param max_capacity maximum number of elements this FixedOrderedSet
-         *        can contain. Defaulted to 5.
+         *        can contain. Defaulted to 5. Ignored if Capacity is not 0.
          */
-        FixedOrderedSet(size_t max_capacity = 5) : Base{ max_capacity }
+        FixedOrderedSet(size_t max_capacity = Capacity > 0 ? Capacity : 5) : Base{ max_capacity }
         {
             // Empty body.
         }
@@ -68,9 +83,92 @@ namespace DuinoCollections
          */
         bool insert(const T& item)
         {
+            thaw();
             return Base::push(item);
         }
 
+        /**
+         * Moves the provided item into this FixedOrderedSet, see insert(const T&).
+         * @param item to insert.
+         * @return true if insertion successful, false otherwise.
+         */
+        bool insert(T&& item)
+        {
+            thaw();
+            return Base::push(Internal::Utils::move(item));
+        }
+
+        /**
+         * Inserts the provided item at the hinted index (in sorted order), without
+         * any search if item belongs there (e.g. hint == size() for increasing items, or an
+         * index returned by find). Any other hint falls back to insert(item).
+         * @param hint expected insertion index.
+         * @param item to insert.
+         * @return true if insertion successful, false otherwise.
+         */
+        bool insert(size_t hint, const T& item)
+        {
+            thaw();
+            return Base::push_hint(hint, item);
+        }
+
+        /**
+         * Moves the provided item in at the hinted index, see
+         * insert(size_t, const T&).
+         * @param hint expected insertion index.
+         * @param item to insert.
+         * @return true if insertion successful, false otherwise.
+         */
+        bool insert(size_t hint, T&& item)
+        {
+            thaw();
+            return Base::push_hint(hint, Internal::Utils::move(item));
+        }
+
+        /**
+         * Builds an item from the provided arguments and inserts it into this
+         * FixedOrderedSet, see insert(const T&).
+         * @param args arguments forwarded to the constructor of T.
+         * @return true if insertion successful, false otherwise.
+         */
+        template<typename... Args>
+        bool emplace(Args&&... args)
+        {
+            thaw();
+            return Base::emplace(Internal::Utils::forward<Args>(args)...);
+        }
+
+        /**
+         * Inserts copies of the items of [first, last) in bulk: they are
+         * appended, sorted once, then duplicates are dropped.
+         * O(n log n) overall instead of one search and shift per item, and
+         * no extra buffer. Items that do not fit are not inserted.
+         * If the range holds equal items, which one is kept is unspecified.
+         * @param first iterator to the first item to insert.
+         * @param last iterator past the last item to insert.
+         * @return the number of items inserted.
+         */
+        template<typename Iterator>
+        size_t insert_range(Iterator first, Iterator last)
+        {
+            thaw();
+            return Base::insert_range(first, last);
+        }
+
+        /**
+         * Replaces the content of this FixedOrderedSet with copies of the items
+         * of [first, last), see insert_range.
+         * @param first iterator to the first item to insert.
+         * @param last iterator past the last item to insert.
+         * @return the number of items inserted.
+         */
+        template<typename Iterator>
+        size_t assign_range(Iterator first, Iterator last)
+        {
+            clear();
+            return Base::insert_range(first, last);
+        }
+
         /**
          * Removes the provided item from this FixedOrderedSet, if possible.
          * Removal may fail if this FixedOrderedSet has no element to
@@ -80,7 +178,531 @@ namespace DuinoCollections
          */
         bool erase(const T& item)
         {
-            return Base::remove_first(item);
+            auto index = find(item);
+            return index != Base::size() && Base::erase_at(thaw_at(index));
         }
+
+        /**
+         * Removes every item from lo (included) to hi (excluded) in sorting
+         * order with two searches and a single block move of the following
+         * items: O(n) at most. A frozen FixedOrderedSet stays frozen if no
+         * item is in the range.
+         * @param lo first item of the range.
+         * @param hi item past the range.
+         * @return the number of items removed.
+         */
+        size_t erase_range(const T& lo, const T& hi)
+        {
+            if (_is_frozen && count_in_range(lo, hi) == 0)
+            {
+                return 0;
+            }
+            thaw();
+            return Base::erase_key_range(lo, hi);
+        }
+
+        /**
+         * Removes and moves out the item at the provided index, see
+         * LinearCollection::remove_at. If this FixedOrderedSet is frozen,
+         * index is a position in the frozen layout.
+         * @param index of the item to remove.
+         * @param out_item item removed (out parameter).
+         * @return true if removal successful, false otherwise.
+         */
+        bool remove_at(size_t index, T& out_item)
+        {
+            return Base::remove_at(thaw_at(index), out_item);
+        }
+
+        /**
+         * Removes all items from this FixedOrderedSet, which is no longer frozen.
+         */
+        void clear(void)
+        {
+            Base::clear();
+            _is_frozen = false;
+        }
+
+        /**
+         * Finds the index of the provided item, if any. Searches the
+         * Eytzinger layout if this FixedOrderedSet is frozen.
+         * @param item to find.
+         * @return the index of item, or size() if not found.
+         */
+        size_t find(const T& item) const
+        {
+            if (_is_frozen)
+            {
+                return Internal::Utils::eytzinger_find(Base::data(), Base::size(), item, SortingOrder{ });
+            }
+            return Base::find(item);
+        }
+
+        /**
+         * Determines whether this FixedOrderedSet contains the provided item.
+         * @param item to check the presence of.
+         * @return true if item present, false otherwise.
+         */
+        [[nodiscard]]
+        bool contains(const T& item) const
+        {
+            return find(item) != Base::size();
+        }
+
+        /**
+         * @param item to look up.
+         * @return the position, in sorting order, of the first item not
+         *         coming before item: the number of items before it.
+         *         Complexity: O(log n), O(log^2 n) if frozen.
+         */
+        size_t lower_bound(const T& item) const
+        {
+            if (_is_frozen)
+            {
+                return frozen_bound(item, SortingOrder{ });
+            }
+            return Base::lower_bound_key(item);
+        }
+
+        /**
+         * @param item to look up.
+         * @return the position, in sorting order, of the first item coming
+         *         after item. Complexity: O(log n), O(log^2 n) if frozen.
+         */
+        size_t upper_bound(const T& item) const
+        {
+            if (_is_frozen)
+            {
+                return frozen_bound(item, UpperBound{ SortingOrder{ } });
+            }
+            return Base::upper_bound_key(item);
+        }
+
+        /**
+         * @param item to look up.
+         * @return the positions, in sorting order, of the items equal to item.
+         */
+        IndexRange equal_range(const T& item) const
+        {
+            return { lower_bound(item), upper_bound(item) };
+        }
+
+        /**
+         * @param item to count.
+         * @return the number of items equal to item, without any scan.
+         */
+        size_t count(const T& item) const
+        {
+            return contains(item) ? 1 : 0;
+        }
+
+        /**
+         * Locates the items from lo (included) to hi (excluded) in sorting
+         * order, e.g. readings of a time window. Empty if hi comes before lo.
+         * @param lo first item of the range.
+         * @param hi item past the range.
+         * @return the positions, in sorting order, of the items in [lo, hi).
+         */
+        IndexRange range(const T& lo, const T& hi) const
+        {
+            auto first = lower_bound(lo);
+            auto last = lower_bound(hi);
+            return { first, last > first ? last : first };
+        }
+
+        /**
+         * @param lo first item of the range.
+         * @param hi item past the range.
+         * @return the number of items in [lo, hi), see range. Complexity: O(log n).
+         */
+        size_t count_in_range(const T& lo, const T& hi) const
+        {
+            return range(lo, hi).size();
+        }
+
+        /**
+         * @param item to rank, present or not.
+         * @return the number of items coming before item, see lower_bound.
+         */
+        size_t rank(const T& item) const
+        {
+            return lower_bound(item);
+        }
+
+        /**
+         * Access the item at the provided position in sorting order, e.g.
+         * the median with select(size() / 2). Positions are those returned
+         * by lower_bound, equal_range, range and rank.
+         * CAUTION: Undefined behavior if out of bounds. Always ensure
+         * position < size().
+         * @param position in sorting order.
+         * @return the reference to the item at position.
+         */
+        const T& select(size_t position) const
+        {
+            return Base::at(_is_frozen ? Internal::Utils::eytzinger_select(position, Base::size()) : position);
+        }
+
+        /**
+         * Rearranges the elements in Eytzinger (breadth-first) layout, in place
+         * and without extra memory: find and contains then probe predictable,
+         * cache-friendly positions. Meant for sets written once and queried
+         * many times.
+         *
+         * While frozen, operator[], at() and iteration follow the frozen
+         * layout, not the sorting order. Any modification (insert, emplace,
+         * erase, remove_at) sorts the elements back first, see thaw().
+         */
+        void freeze(void)
+        {
+            if (!_is_frozen && Base::is_valid())
+            {
+                Internal::Utils::to_eytzinger(Base::data(), Base::size());
+                _is_frozen = true;
+            }
+        }
+
+        /**
+         * Sorts back the elements of a frozen FixedOrderedSet. Does nothing
+         * if it is not frozen.
+         */
+        void thaw(void)
+        {
+            if (_is_frozen)
+            {
+                Internal::Utils::from_eytzinger(Base::data(), Base::size());
+                _is_frozen = false;
+            }
+        }
+
+        /**
+         * @return true if the elements are in frozen layout, false if sorted.
+         */
+        [[nodiscard]]
+        bool is_frozen(void) const
+        {
+            return _is_frozen;
+        }
+
+        /**
+         * Determines whether every item of other is in this FixedOrderedSet.
+         * Both sets are walked once in sorting order: O(n + m).
+         * @param other set of the same type and sorting order, of any capacity.
+         * @return true if other is a subset of this FixedOrderedSet.
+         */
+        template<size_t OtherCapacity, typename OtherSearch>
+        bool includes(const FixedOrderedSet<T, SortingOrder, OtherCapacity, OtherSearch>& other) const
+        {
+            SortingOrder order{ };
+            auto mine = sorted_cursor();
+            for (auto theirs = other.sorted_cursor(); !theirs.is_done(); theirs.advance())
+            {
+                while (!mine.is_done() && order(mine.get(), theirs.get()))
+                {
+                    mine.advance();
+                }
+                if (mine.is_done() || order(theirs.get(), mine.get()))
+                {
+                    return false;
+                }
+                mine.advance();
+            }
+            return true;
+        }
+
+        /**
+         * Inserts every item of other missing from this FixedOrderedSet, in a
+         * single merge pass: O(n + m) instead of one search and shift per item,
+         * and no extra buffer. Nothing is inserted if the union does not fit.
+         * @param other set of the same type and sorting order, of any capacity.
+         * @return true if this FixedOrderedSet now holds the union, false otherwise.
+         */
+        template<size_t OtherCapacity, typename OtherSearch>
+        bool set_union(const FixedOrderedSet<T, SortingOrder, OtherCapacity, OtherSearch>& other)
+        {
+            thaw();
+            size_t added = 0;
+            merge(sorted_cursor(), other.sorted_cursor(), ONLY_IN_SECOND, [&added](const T&) { added++; });
+            if (added == 0)
+            {
+                return true;
+            }
+
+            auto size = Base::size();
+            if (!Base::is_valid() || added > Base::capacity() - size)
+            {
+                return false;
+            }
+
+            // Open added raw slots at the front, then merge forwards: the write
+            // position cannot pass the read position while items of other remain.
+            SortingOrder order{ };
+            auto data = Base::data();
+            Internal::Utils::relocate_elements(data + added, data, size);
+            auto theirs = other.sorted_cursor();
+            auto read = added;
+            auto end = added + size;
+            for (size_t write = 0; write < read; write++)
+            {
+                if (read < end && !order(theirs.get(), data[read]))
+                {
+                    if (!order(data[read], theirs.get()))
+                    {
+                        theirs.advance();
+                    }
+                    Internal::Utils::relocate_elements(data + write, data + read, 1);
+                    read++;
+                }
+                else
+                {
+                    Internal::Utils::construct_at(data + write, theirs.get());
+                    theirs.advance();
+                }
+            }
+            Base::set_size(end);
+            return true;
+        }
+
+        /**
+         * Removes every item that is not in other, in a single merge pass: O(n + m).
+         * @param other set of the same type and sorting order, of any capacity.
+         */
+        template<size_t OtherCapacity, typename OtherSearch>
+        void set_intersection(const FixedOrderedSet<T, SortingOrder, OtherCapacity, OtherSearch>& other)
+        {
+            retain(other, true);
+        }
+
+        /**
+         * Removes every item that is in other, in a single merge pass: O(n + m).
+         * @param other set of the same type and sorting order, of any capacity.
+         */
+        template<size_t OtherCapacity, typename OtherSearch>
+        void set_difference(const FixedOrderedSet<T, SortingOrder, OtherCapacity, OtherSearch>& other)
+        {
+            retain(other, false);
+        }
+
+        /**
+         * Replaces the content of this FixedOrderedSet with the union of first
+         * and second, merged in O(n + m). This FixedOrderedSet may be one of
+         * the operands. Left untouched if the union does not fit.
+         * @param first set of the same type and sorting order, of any capacity.
+         * @param second set of the same type and sorting order, of any capacity.
+         * @return true if this FixedOrderedSet now holds the union, false otherwise.
+         */
+        template<size_t FirstCapacity, typename FirstSearch, size_t SecondCapacity, typename SecondSearch>
+        bool set_union(
+            const FixedOrderedSet<T, SortingOrder, FirstCapacity, FirstSearch>& first,
+            const FixedOrderedSet<T, SortingOrder, SecondCapacity, SecondSearch>& second)
+        {
+            if (is_same(first))
+            {
+                return set_union(second);
+            }
+            if (is_same(second))
+            {
+                return set_union(first);
+            }
+            return assign_merge(first.sorted_cursor(), second.sorted_cursor(), ONLY_IN_FIRST | ONLY_IN_SECOND | IN_BOTH);
+        }
+
+        /**
+         * Replaces the content of this FixedOrderedSet with the intersection of
+         * first and second, see set_union(first, second).
+         * @param first set of the same type and sorting order, of any capacity.
+         * @param second set of the same type and sorting order, of any capacity.
+         * @return true if this FixedOrderedSet now holds the intersection,
+         *         false otherwise.
+         */
+        template<size_t FirstCapacity, typename FirstSearch, size_t SecondCapacity, typename SecondSearch>
+        bool set_intersection(
+            const FixedOrderedSet<T, SortingOrder, FirstCapacity, FirstSearch>& first,
+            const FixedOrderedSet<T, SortingOrder, SecondCapacity, SecondSearch>& second)
+        {
+            if (is_same(first))
+            {
+                set_intersection(second);
+                return true;
+            }
+            if (is_same(second))
+            {
+                set_intersection(first);
+                return true;
+            }
+            return assign_merge(first.sorted_cursor(), second.sorted_cursor(), IN_BOTH);
+        }
+
+        /**
+         * Replaces the content of this FixedOrderedSet with the items of first
+         * that are not in second, see set_union(first, second). This
+         * FixedOrderedSet may be first but not second.
+         * @param first set of the same type and sorting order, of any capacity.
+         * @param second set of the same type and sorting order, of any capacity.
+         * @return true if this FixedOrderedSet now holds the difference,
+         *         false otherwise.
+         */
+        template<size_t FirstCapacity, typename FirstSearch, size_t SecondCapacity, typename SecondSearch>
+        bool set_difference(
+            const FixedOrderedSet<T, SortingOrder, FirstCapacity, FirstSearch>& first,
+            const FixedOrderedSet<T, SortingOrder, SecondCapacity, SecondSearch>& second)
+        {
+            if (is_same(first))
+            {
+                set_difference(second);
+                return true;
+            }
+            if (is_same(second))
+            {
+                return false;
+            }
+            return assign_merge(first.sorted_cursor(), second.sorted_cursor(), ONLY_IN_FIRST);
+        }
+
+    private:
+        template<typename, typename, size_t, typename>
+        friend class FixedOrderedSet;
+
+        using Cursor = Internal::Utils::SortedCursor<T>;
+        using UpperBound = Internal::Policy::Indexing::UpperBoundOrder<SortingOrder>;
+
+        // Items emitted by merge.
+        static const uint8_t ONLY_IN_FIRST{ 1 };
+        static const uint8_t ONLY_IN_SECOND{ 2 };
+        static const uint8_t IN_BOTH{ 4 };
+
+        // Walks the items in sorting order, frozen or not.
+        Cursor sorted_cursor(void) const
+        {
+            return Cursor{ Base::data(), Base::size(), _is_frozen };
+        }
+
+        template<size_t OtherCapacity, typename OtherSearch>
+        bool is_same(const FixedOrderedSet<T, SortingOrder, OtherCapacity, OtherSearch>& other) const
+        {
+            return static_cast<const void*>(&other) == static_cast<const void*>(this);
+        }
+
+        // Walks both cursors at once and emits, in sorting order, the items
+        // selected by keep (ONLY_IN_FIRST, ONLY_IN_SECOND, IN_BOTH).
+        template<typename Emit>
+        static void merge(Cursor first, Cursor second, uint8_t keep, Emit emit)
+        {
+            SortingOrder order{ };
+            while (!first.is_done() && !second.is_done())
+            {
+                if (order(first.get(), second.get()))
+                {
+                    if (keep & ONLY_IN_FIRST)
+                    {
+                        emit(first.get());
+                    }
+                    first.advance();
+                }
+                else if (order(second.get(), first.get()))
+                {
+                    if (keep & ONLY_IN_SECOND)
+                    {
+                        emit(second.get());
+                    }
+                    second.advance();
+                }
+                else
+                {
+                    if (keep & IN_BOTH)
+                    {
+                        emit(first.get());
+                    }
+                    first.advance();
+                    second.advance();
+                }
+            }
+
+            for (; (keep & ONLY_IN_FIRST) && !first.is_done(); first.advance())
+            {
+                emit(first.get());
+            }
+            for (; (keep & ONLY_IN_SECOND) && !second.is_done(); second.advance())
+            {
+                emit(second.get());
+            }
+        }
+
+        // Replaces the content with the merge of first and second, provided
+        // it fits. The merge is run twice: to count, then to copy.
+        bool assign_merge(Cursor first, Cursor second, uint8_t keep)
+        {
+            size_t count = 0;
+            merge(first, second, keep, [&count](const T&) { count++; });
+            if (!Base::is_valid() || count > Base::capacity())
+            {
+                return false;
+            }
+
+            clear();
+            auto data = Base::data();
+            size_t size = 0;
+            merge(first, second, keep, [data, &size](const T& item)
+            {
+                Internal::Utils::construct_at(data + size, item);
+                size++;
+            });
+            Base::set_size(size);
+            return true;
+        }
+
+        // Compacts the items found (keep_common) or not found in other to
+        // the front and destroys the rest.
+        template<size_t OtherCapacity, typename OtherSearch>
+        void retain(const FixedOrderedSet<T, SortingOrder, OtherCapacity, OtherSearch>& other, bool keep_common)
+        {
+            thaw();
+            SortingOrder order{ };
+            auto data = Base::data();
+            auto size = Base::size();
+            auto theirs = other.sorted_cursor();
+            size_t write = 0;
+            for (size_t read = 0; read < size; read++)
+            {
+                while (!theirs.is_done() && order(theirs.get(), data[read]))
+                {
+                    theirs.advance();
+                }
+                bool is_common = !theirs.is_done() && !order(data[read], theirs.get());
+                if (is_common != keep_common)
+                {
+                    continue;
+                }
+                if (write != read)
+                {
+                    data[write] = Internal::Utils::move(data[read]);
+                }
+                write++;
+            }
+            Internal::Utils::destroy_elements(data + write, size - write);
+            Base::set_size(write);
+        }
+
+        // Sorted position of the frozen element bounding item with order.
+        template<typename BoundOrder>
+        size_t frozen_bound(const T& item, const BoundOrder& order) const
+        {
+            auto slot = Internal::Utils::eytzinger_lower_bound(Base::data(), Base::size(), item, order);
+            return slot == Base::size() ? slot : Internal::Utils::eytzinger_rank(slot, Base::size());
+        }
+
+        // Sorts the elements back and returns the sorted position of the
+        // element found at index in the frozen layout.
+        size_t thaw_at(size_t index)
+        {
+            if (_is_frozen && index < Base::size())
+            {
+                index = Internal::Utils::eytzinger_rank(index, Base::size());
+            }
+            thaw();
+            return index;
+        }
+
+        bool _is_frozen{ false };
     };
 }
\ No newline at end of file
@@ -21,6 +21,8 @@
 #pragma once
 #include "internal/LinearCollection.hpp"
 #include "SortingOrder.hpp"
+#include "SearchStrategy.hpp"
+#include "IndexRange.hpp"
 #include "internal/policy/indexing/OrderedIndexingPolicy.hpp"
 #include "internal/policy/duplication/DuplicationPolicy.hpp"
 
@@ -30,21 +32,28 @@ namespace DuinoCollections
      * Ordered collection of items that allows duplicates.
      * Unlike FixedVector, OrderedFixedVector cannot be used
      * as a stack.
-     * @param T can be any type as long as it implements a
-     *        default initializer, equality operators == and !=
+     * @param T can be any movable type as long as it implements
+     *        equality operators == and !=
      *        and comparison operators <, <=, > and >=.
      * @param SortingOrder can be either ascending or descending.
      *        Defaulted to Ascending.
+     * @param Capacity if not 0, elements are stored inline (no heap
+     *        allocation) and the capacity is fixed at compile time.
+     *        Defaulted to 0: capacity is provided at construction.
+     * @param Search lower bound kernel used by lookups and insertions, see
+     *        SearchStrategy.hpp. Defaulted to BinarySearch.
      */
-    template<typename T, typename SortingOrder = Ascending<T>>
+    template<typename T, typename SortingOrder = Ascending<T>, size_t Capacity = 0, typename Search = BinarySearch>
     class FixedOrderedVector : public Internal::LinearCollection<
-        T, Internal::Policy::Indexing::OrderedIndexingPolicy<T, SortingOrder>,
-        Internal::Policy::Duplication::DuplicationPolicy::ALLOW_DUPLICATES
+        T, Internal::Policy::Indexing::OrderedIndexingPolicy<T, SortingOrder, Search>,
+        Internal::Policy::Duplication::DuplicationPolicy::ALLOW_DUPLICATES,
+        Capacity
     >
     {
         using Base = Internal::LinearCollection<
-            T, Internal::Policy::Indexing::OrderedIndexingPolicy<T, SortingOrder>,
-            Internal::Policy::Duplication::DuplicationPolicy::ALLOW_DUPLICATES
+            T, Internal::Policy::Indexing::OrderedIndexingPolicy<T, SortingOrder, Search>,
+            Internal::Policy::Duplication::DuplicationPolicy::ALLOW_DUPLICATES,
+            Capacity
         >;
 
     public:
@@ -52,9 +61,9 @@ namespace DuinoCollections
          * Initializes this FixedOrderedVector with the provided capacity.
          * If none is provided, it shall be defaulted to 5.
          * @param max_capacity maximum number of elements this FixedOrderedVector
-         *        can contain. Defaulted to 5.
+         *        can contain. Defaulted to 5. Ignored if Capacity is not 0.
          */
-        FixedOrderedVector(size_t max_capacity = 5) : Base{ max_capacity }
+        FixedOrderedVector(size_t max_capacity = Capacity > 0 ? Capacity : 5) : Base{ max_capacity }
         {
             // Empty body.
         }
@@ -71,6 +80,82 @@ namespace DuinoCollections
             return Base::push(item);
         }
 
+        /**
+         * Moves the provided item into this FixedOrderedVector, see insert(const T&).
+         * @param item to insert.
+         * @return true if insertion successful, false otherwise.
+         */
+        bool insert(T&& item)
+        {
+            return Base::push(Internal::Utils::move(item));
+        }
+
+        /**
+         * Inserts the provided item at the hinted index, without any search if
+         * item belongs there (e.g. hint == size() for increasing items, or an
+         * index returned by find). Any other hint falls back to insert(item).
+         * @param hint expected insertion index.
+         * @param item to insert.
+         * @return true if insertion successful, false otherwise.
+         */
+        bool insert(size_t hint, const T& item)
+        {
+            return Base::push_hint(hint, item);
+        }
+
+        /**
+         * Moves the provided item in at the hinted index, see
+         * insert(size_t, const T&).
+         * @param hint expected insertion index.
+         * @param item to insert.
+         * @return true if insertion successful, false otherwise.
+         */
+        bool insert(size_t hint, T&& item)
+        {
+            return Base::push_hint(hint, Internal::Utils::move(item));
+        }
+
+        /**
+         * Builds an item from the provided arguments and inserts it into this
+         * FixedOrderedVector, see insert(const T&).
+         * @param args arguments forwarded to the constructor of T.
+         * @return true if insertion successful, false otherwise.
+         */
+        template<typename... Args>
+        bool emplace(Args&&... args)
+        {
+            return Base::emplace(Internal::Utils::forward<Args>(args)...);
+        }
+
+        /**
+         * Inserts copies of the items of [first, last) in bulk: they are
+         * appended, then the whole FixedOrderedVector is sorted once.
+         * O(n log n) overall instead of one search and shift per item, and
+         * no extra buffer. Items that do not fit are not inserted.
+         * @param first iterator to the first item to insert.
+         * @param last iterator past the last item to insert.
+         * @return the number of items inserted.
+         */
+        template<typename Iterator>
+        size_t insert_range(Iterator first, Iterator last)
+        {
+            return Base::insert_range(first, last);
+        }
+
+        /**
+         * Replaces the content of this FixedOrderedVector with copies of the items
+         * of [first, last), see insert_range.
+         * @param first iterator to the first item to insert.
+         * @param last iterator past the last item to insert.
+         * @return the number of items inserted.
+         */
+        template<typename Iterator>
+        size_t assign_range(Iterator first, Iterator last)
+        {
+            Base::clear();
+            return Base::insert_range(first, last);
+        }
+
         /**
          * Removes the first occurrence of the provided item from this 
          * FixedOrderedVector, if possible. Removal may fail if this
@@ -95,6 +180,105 @@ namespace DuinoCollections
             return Base::remove_all(item);
         }
 
+        /**
+         * Removes every item from lo (included) to hi (excluded) in sorting
+         * order, e.g. expired timestamps, with two searches and a single
+         * block move of the following items: O(n) at most.
+         * @param lo first item of the range.
+         * @param hi item past the range.
+         * @return the number of items removed.
+         */
+        size_t erase_range(const T& lo, const T& hi)
+        {
+            return Base::erase_key_range(lo, hi);
+        }
+
+        /**
+         * @param item to look up.
+         * @return the position, in sorting order, of the first item not
+         *         coming before item: the number of items before it.
+         *         Complexity: O(log n).
+         */
+        size_t lower_bound(const T& item) const
+        {
+            return Base::lower_bound_key(item);
+        }
+
+        /**
+         * @param item to look up.
+         * @return the position, in sorting order, of the first item coming
+         *         after item. Complexity: O(log n).
+         */
+        size_t upper_bound(const T& item) const
+        {
+            return Base::upper_bound_key(item);
+        }
+
+        /**
+         * @param item to look up.
+         * @return the positions, in sorting order, of the items equal to item.
+         */
+        IndexRange equal_range(const T& item) const
+        {
+            return { lower_bound(item), upper_bound(item) };
+        }
+
+        /**
+         * @param item to count.
+         * @return the number of items equal to item, without any scan.
+         */
+        size_t count(const T& item) const
+        {
+            return equal_range(item).size();
+        }
+
+        /**
+         * Locates the items from lo (included) to hi (excluded) in sorting
+         * order, e.g. readings of a time window. Empty if hi comes before lo.
+         * @param lo first item of the range.
+         * @param hi item past the range.
+         * @return the positions, in sorting order, of the items in [lo, hi).
+         */
+        IndexRange range(const T& lo, const T& hi) const
+        {
+            auto first = lower_bound(lo);
+            auto last = lower_bound(hi);
+            return { first, last > first ? last : first };
+        }
+
+        /**
+         * @param lo first item of the range.
+         * @param hi item past the range.
+         * @return the number of items in [lo, hi), see range. Complexity: O(log n).
+         */
+        size_t count_in_range(const T& lo, const T& hi) const
+        {
+            return range(lo, hi).size();
+        }
+
+        /**
+         * @param item to rank, present or not.
+         * @return the number of items coming before item, see lower_bound.
+         */
+        size_t rank(const T& item) const
+        {
+            return lower_bound(item);
+        }
+
+        /**
+         * Access the item at the provided position in sorting order, e.g.
+         * the median with select(size() / 2). Positions are those returned
+         * by lower_bound, equal_range, range and rank.
+         * CAUTION: Undefined behavior if out of bounds. Always ensure
+         * position < size().
+         * @param position in sorting order.
+         * @return the reference to the item at position.
+         */
+        const T& select(size_t position) const
+        {
+            return Base::at(position);
+        }
+
         /**
          * CAUTION: Undefined behavior if out of bounds. Always ensure collection
          *          is not empty before calling.
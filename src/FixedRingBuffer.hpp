@@ -20,7 +20,12 @@
  */
 #pragma once
 #include <stddef.h>
+#include <stdint.h>
 #include "internal/utils/ScopedInterruptLock.hpp"
+#include "internal/utils/AtomicIndex.hpp"
+#include "internal/utils/TypeTraits.hpp"
+#include "internal/utils/Memory.hpp"
+#include "internal/policy/storage/StoragePolicy.hpp"
 
 namespace DuinoCollections
 {
@@ -28,82 +33,88 @@ namespace DuinoCollections
      * Determines what to do when pushing on a full FixedRingBuffer:
      * - Reject -> push fails and return status is false.
      * - Overwrite -> erase oldest data and always succeed.
+     * - SPSC -> reject, and allow one producer and one consumer to run
+     *   concurrently (e.g. ISR and loop()) without disabling interrupts.
+     *   The producer only calls push / push_atomic, the consumer calls
+     *   everything else. Both are wait-free.
      */
     enum class RingBufferMode : uint8_t
     {
         REJECT,
-        OVERWRITE
+        OVERWRITE,
+        SPSC
+    };
+
+    /**
+     * Contiguous region of a FixedRingBuffer's storage, handed out for
+     * zero-copy transfers.
+     * @param T type of objects in the region.
+     */
+    template<typename T>
+    struct RingBufferSpan
+    {
+        T* data;
+        size_t length;
     };
 
     /**
      * Fixed-capacity circular FIFO buffer. Provides
      * fast and ISR-safe data access.
-     * @param T type of objects contained. Must have a default
-     *          initializer.
+     * Elements live in raw storage: each one is constructed in place when
+     * pushed and destroyed when popped, consumed or overwritten.
+     * @param T type of objects contained. Any movable type, no default
+     *          initializer is required.
+     * @param PushMode behavior when full, see RingBufferMode.
+     * @param Capacity if not 0, elements are stored inline in an array of
+     *        Capacity elements (no heap allocation). If 0 (default), the
+     *        capacity is provided at construction and the array is
+     *        allocated once on the heap.
      */
-    template<typename T, RingBufferMode PushMode = RingBufferMode::REJECT>
+    template<typename T, RingBufferMode PushMode = RingBufferMode::REJECT, size_t Capacity = 0>
     class FixedRingBuffer
     {
     public:
         /**
          * Initializes this FixedRingBuffer with the provided max_capacity.
-         * If none is provided, it shall be defaulted to 5.
+         * If none is provided, it shall be defaulted to 5, or to Capacity
+         * if the storage is inline.
          * @param max_capacity maximum number of elements (size) this FixedRingBuffer
-         *        can have. Defaulted to 5.
+         *        can have. Ignored if Capacity is not 0.
          */
-        explicit FixedRingBuffer(size_t max_capacity = 5)
-            : _data{ max_capacity > 0 ? new T[max_capacity] : nullptr }
-            , _capacity{ max_capacity }
-            , _size{ 0 }
+        explicit FixedRingBuffer(size_t max_capacity = Capacity > 0 ? Capacity : 5)
+            : _storage{ max_capacity }
             , _head{ 0 }
             , _tail{ 0 }
         {
-            if (_data == nullptr)
-            {
-                _capacity = 0;
-            }
+            // Empty body.
         }
 
         ~FixedRingBuffer(void)
         {
-            delete[] _data;
+            clear();
         }
 
-        // Forbid copy to avoid double delete.
+        // Forbid copy to avoid double free.
         FixedRingBuffer(const FixedRingBuffer&) = delete;
         FixedRingBuffer& operator=(const FixedRingBuffer&) = delete;
 
         FixedRingBuffer(FixedRingBuffer&& other) noexcept
-            : _data{ other._data }
-            , _capacity{ other._capacity }
-            , _size{ other._size }
-            , _head{ other._head }
-            , _tail{ other._tail }
+            : _storage{ Internal::Utils::move(other._storage) }
+            , _head{ other._head.load_relaxed() }
+            , _tail{ other._tail.load_relaxed() }
         {
-            other._data = nullptr;
-            other._capacity = 0;
-            other._size = 0;
-            other._head = 0;
-            other._tail = 0;
+            take_elements(other);
         }
 
         FixedRingBuffer& operator=(FixedRingBuffer&& other) noexcept
         {
             if (this != &other)
             {
-                delete[] _data;
-
-                _data = other._data;
-                _capacity = other._capacity;
-                _size = other._size;
-                _head = other._head;
-                _tail = other._tail;
-
-                other._data = nullptr;
-                other._capacity = 0;
-                other._size = 0;
-                other._head = 0;
-                other._tail = 0;
+                clear();
+                _storage = Internal::Utils::move(other._storage);
+                _head.store_relaxed(other._head.load_relaxed());
+                _tail.store_relaxed(other._tail.load_relaxed());
+                take_elements(other);
             }
             return *this;
         }
@@ -111,56 +122,66 @@ namespace DuinoCollections
         /**
          * Push the provided item at the end of this FixedRingBuffer.
          * Push may fail if this FixedRingBuffer is full.
+         * In SPSC mode, only the producer context may call this method.
          * @return true if push was successful, false otherwise.
          */
         bool push(const T& item)
         {
-            if (!is_valid())
-            {
-                return false;
-            }
-
-            if (is_full())
-            {
-                if (PushMode == RingBufferMode::REJECT)
-                {
-                    return false;
-                }
+            return push_item(item);
+        }
 
-                _head = next(_head);
-                _size--;
-            }
+        /**
+         * Moves the provided item at the end of this FixedRingBuffer, see
+         * push(const T&). item is left untouched on failure.
+         * @return true if push was successful, false otherwise.
+         */
+        bool push(T&& item)
+        {
+            return push_item(Internal::Utils::move(item));
+        }
 
-            _data[_tail] = item;
-            _tail = next(_tail);
-            _size++;
-            return true;
+        /**
+         * Builds an item in place from the provided arguments at the end of
+         * this FixedRingBuffer, see push(const T&).
+         * @param args arguments forwarded to the constructor of T.
+         * @return true if emplace was successful, false otherwise.
+         */
+        template<typename... Args>
+        bool emplace(Args&&... args)
+        {
+            return push_item(Internal::Utils::forward<Args>(args)...);
         }
 
         /**
          * Pops the oldest element in this FixedRingBuffer.
          * Pop may fail if this FixedRingBuffer is empty.
+         * In SPSC mode, only the consumer context may call this method.
+         * @param out_value removed item, moved out of this FixedRingBuffer
+         *        (out parameter).
          * @return true if pop was successful, false otherwise.
          */
         bool pop(T& out_value)
         {
-            if (!is_valid() || is_empty())
+            auto head = _head.load_relaxed();
+            if (!is_valid() || head == _tail.load_acquire())
             {
                 return false;
             }
 
-            out_value = _data[_head];
-            _head = next(_head);
-            _size--;
+            auto slot = _storage.data() + physical(head);
+            out_value = Internal::Utils::move(*slot);
+            Internal::Utils::destroy_at(slot);
+            _head.store_release(next(head));
             return true;
         }
 
         /**
-         * @return true if _data is valid (not null), false otherwise.
+         * @return true if the storage is usable, false otherwise.
+         *         Always true if the storage is inline.
          */
         bool is_valid(void) const 
         { 
-            return _data != nullptr; 
+            return _storage.is_valid(); 
         }
 
         /**
@@ -168,7 +189,7 @@ namespace DuinoCollections
          */
         size_t capacity(void) const 
         { 
-            return _capacity; 
+            return _storage.capacity(); 
         }
         
         /**
@@ -176,7 +197,7 @@ namespace DuinoCollections
          */
         size_t size(void) const 
         { 
-            return _size; 
+            return distance(_head.load_acquire(), _tail.load_acquire());
         }
 
         /**
@@ -184,7 +205,7 @@ namespace DuinoCollections
          */
         bool is_empty(void) const 
         { 
-            return _size == 0; 
+            return size() == 0; 
         }
 
         /**
@@ -193,18 +214,19 @@ namespace DuinoCollections
          */
         bool is_full(void) const 
         { 
-            return _size >= _capacity;
+            return size() >= capacity();
         }
 
         /**
-         * Marks the buffer as empty. Stored values remain in memory
-         * until overwritten.
+         * Destroys every element and marks the buffer as empty.
+         * In SPSC mode, only the consumer context may call this method.
          */
         void clear(void)
         {
-            _size = 0;
-            _head = 0;
-            _tail = 0;
+            auto head = _head.load_relaxed();
+            auto tail = _tail.load_acquire();
+            destroy_block(head, distance(head, tail));
+            _head.store_release(tail);
         }
 
         /**
@@ -216,6 +238,8 @@ namespace DuinoCollections
          * (e.g. loop()) and an interrupt routine.
          *
          * Internally, this method calls push() within a critical section.
+         * In SPSC mode, no critical section is needed and interrupts are
+         * left untouched.
          *
          * @param item Item to add to the collection.
          * @return true if the item was successfully added, false otherwise
@@ -228,10 +252,34 @@ namespace DuinoCollections
          */
         bool push_atomic(const T& item)
         {
+            if (PushMode == RingBufferMode::SPSC)
+            {
+                return push(item);
+            }
+
             Internal::Utils::ScopedInterruptLock lock{};
             return push(item);
         }
 
+        /**
+         * Atomically moves an item into the collection, see push_atomic(const T&).
+         * @param item Item to move into the collection.
+         * @return true if the item was successfully added, false otherwise.
+         *
+         * @warning This method must NOT be called from within an ISR, as it will
+         * re-enable interrupts when exiting the critical section.
+         */
+        bool push_atomic(T&& item)
+        {
+            if (PushMode == RingBufferMode::SPSC)
+            {
+                return push(Internal::Utils::move(item));
+            }
+
+            Internal::Utils::ScopedInterruptLock lock{};
+            return push(Internal::Utils::move(item));
+        }
+
         /**
          * Atomically removes an item from the collection.
          *
@@ -241,6 +289,8 @@ namespace DuinoCollections
          * (e.g. loop()) and an interrupt routine.
          *
          * Internally, this method calls pop() within a critical section.
+         * In SPSC mode, no critical section is needed and interrupts are
+         * left untouched.
          *
          * @param out_value Reference where the removed item will be stored.
          * @return true if an item was successfully removed, false otherwise
@@ -253,10 +303,272 @@ namespace DuinoCollections
          */
         bool pop_atomic(T& out_value)
         {
+            if (PushMode == RingBufferMode::SPSC)
+            {
+                return pop(out_value);
+            }
+
             Internal::Utils::ScopedInterruptLock lock{};
             return pop(out_value);
         }
 
+        /**
+         * Pushes up to count items at the end of this FixedRingBuffer in at
+         * most two block copies (before and after the physical end of the
+         * storage). Trivially copyable types are copied with memcpy.
+         * In REJECT and SPSC modes, only the items that fit are pushed.
+         * In OVERWRITE mode, every item is pushed and the oldest data is
+         * discarded as needed.
+         * In SPSC mode, only the producer context may call this method.
+         * @param items array of at least count elements.
+         * @param count number of items to push.
+         * @return the number of items pushed.
+         */
+        size_t push_n(const T* items, size_t count)
+        {
+            if (!is_valid() || count == 0)
+            {
+                return 0;
+            }
+
+            auto tail = _tail.load_relaxed();
+            auto head = _head.load_acquire();
+            auto available = capacity() - distance(head, tail);
+            auto pushed = count;
+
+            if (count > available)
+            {
+                if (PushMode != RingBufferMode::OVERWRITE)
+                {
+                    count = available;
+                    pushed = available;
+                }
+                else
+                {
+                    // Only the most recent items survive.
+                    if (count > capacity())
+                    {
+                        items += count - capacity();
+                        count = capacity();
+                    }
+                    destroy_block(head, count - available);
+                    _head.store_relaxed(advance(head, count - available));
+                }
+            }
+
+            write_block(physical(tail), items, count);
+            _tail.store_release(advance(tail, count));
+            return pushed;
+        }
+
+        /**
+         * Pops up to count of the oldest items of this FixedRingBuffer in at
+         * most two block copies. Trivially copyable types are copied with
+         * memcpy. Popped elements are destroyed once copied out.
+         * In SPSC mode, only the consumer context may call this method.
+         * @param out_items array of at least count elements (out parameter).
+         * @param count maximum number of items to pop.
+         * @return the number of items popped.
+         */
+        size_t pop_n(T* out_items, size_t count)
+        {
+            auto head = _head.load_relaxed();
+            auto stored = distance(head, _tail.load_acquire());
+            if (!is_valid() || stored == 0 || count == 0)
+            {
+                return 0;
+            }
+
+            if (count > stored)
+            {
+                count = stored;
+            }
+
+            read_block(physical(head), out_items, count);
+            destroy_block(head, count);
+            _head.store_release(advance(head, count));
+            return count;
+        }
+
+        /**
+         * Exposes the storage following the last element so that a driver
+         * (DMA, Serial.readBytes...) can write into it directly. The region
+         * stops at the physical end of the storage; call reserve() again after
+         * commit() to get the wrapped-around part.
+         * Nothing is published until commit() is called.
+         * In REJECT and SPSC modes, the region only covers free slots. In
+         * OVERWRITE mode, it may cover the oldest elements.
+         * In SPSC mode, only the producer context may call this method.
+         * Only available for trivially copyable types, since the region
+         * holds raw memory the caller writes to without constructing objects.
+         * @param max_count maximum number of elements the caller will write.
+         * @return writable region, { nullptr, 0 } if none is available.
+         */
+        RingBufferSpan<T> reserve(size_t max_count)
+        {
+            static_assert(Internal::Utils::IsTriviallyCopyable<T>::value,
+                "reserve() requires a trivially copyable type");
+
+            if (!is_valid())
+            {
+                return { nullptr, 0 };
+            }
+
+            auto tail = _tail.load_relaxed();
+            auto start = physical(tail);
+            auto length = capacity() - start;
+            if (PushMode != RingBufferMode::OVERWRITE)
+            {
+                auto available = capacity() - distance(_head.load_acquire(), tail);
+                if (length > available)
+                {
+                    length = available;
+                }
+            }
+
+            if (length > max_count)
+            {
+                length = max_count;
+            }
+
+            return { length > 0 ? _storage.data() + start : nullptr, length };
+        }
+
+        /**
+         * Publishes count elements written in the region returned by reserve().
+         * Commit may fail if count exceeds that region.
+         * In OVERWRITE mode, the oldest elements are discarded as needed.
+         * In SPSC mode, only the producer context may call this method.
+         * @param count number of elements written, at most the length
+         *        returned by the last call to reserve().
+         * @return true if commit was successful, false otherwise.
+         */
+        bool commit(size_t count)
+        {
+            static_assert(Internal::Utils::IsTriviallyCopyable<T>::value,
+                "commit() requires a trivially copyable type");
+
+            auto tail = _tail.load_relaxed();
+            if (!is_valid() || count > capacity() - physical(tail))
+            {
+                return false;
+            }
+
+            auto head = _head.load_acquire();
+            auto available = capacity() - distance(head, tail);
+            if (count > available)
+            {
+                if (PushMode != RingBufferMode::OVERWRITE)
+                {
+                    return false;
+                }
+
+                _head.store_relaxed(advance(head, count - available));
+            }
+
+            _tail.store_release(advance(tail, count));
+            return true;
+        }
+
+        /**
+         * Exposes the oldest elements so that a block-oriented sink
+         * (Serial.write, SD card...) can read them in place. The region
+         * stops at the physical end of the storage; call peek_contiguous()
+         * again after consume() to get the wrapped-around part.
+         * In SPSC mode, only the consumer context may call this method.
+         * @return readable region, { nullptr, 0 } if this FixedRingBuffer
+         *         is empty.
+         */
+        RingBufferSpan<const T> peek_contiguous(void) const
+        {
+            if (!is_valid())
+            {
+                return { nullptr, 0 };
+            }
+
+            auto head = _head.load_relaxed();
+            auto start = physical(head);
+            auto length = distance(head, _tail.load_acquire());
+            if (length > capacity() - start)
+            {
+                length = capacity() - start;
+            }
+
+            return { length > 0 ? _storage.data() + start : nullptr, length };
+        }
+
+        /**
+         * Discards the count oldest elements, typically after reading them
+         * through peek_contiguous().
+         * Consume may fail if this FixedRingBuffer holds less than count
+         * elements.
+         * In SPSC mode, only the consumer context may call this method.
+         * @param count number of elements to discard.
+         * @return true if consume was successful, false otherwise.
+         */
+        bool consume(size_t count)
+        {
+            auto head = _head.load_relaxed();
+            if (!is_valid() || count > distance(head, _tail.load_acquire()))
+            {
+                return false;
+            }
+
+            destroy_block(head, count);
+            _head.store_release(advance(head, count));
+            return true;
+        }
+
+        /**
+         * Atomically pushes up to count items, see push_n().
+         *
+         * Interrupts are disabled once for the whole batch rather than once
+         * per element. In SPSC mode, no critical section is needed and
+         * interrupts are left untouched.
+         *
+         * @param items array of at least count elements.
+         * @param count number of items to push.
+         * @return the number of items pushed.
+         *
+         * @warning This method must NOT be called from within an ISR, as it will
+         * re-enable interrupts when exiting the critical section.
+         */
+        size_t push_n_atomic(const T* items, size_t count)
+        {
+            if (PushMode == RingBufferMode::SPSC)
+            {
+                return push_n(items, count);
+            }
+
+            Internal::Utils::ScopedInterruptLock lock{};
+            return push_n(items, count);
+        }
+
+        /**
+         * Atomically pops up to count items, see pop_n().
+         *
+         * Interrupts are disabled once for the whole batch rather than once
+         * per element. In SPSC mode, no critical section is needed and
+         * interrupts are left untouched.
+         *
+         * @param out_items array of at least count elements (out parameter).
+         * @param count maximum number of items to pop.
+         * @return the number of items popped.
+         *
+         * @warning This method must NOT be called from within an ISR, as it will
+         * re-enable interrupts when exiting the critical section.
+         */
+        size_t pop_n_atomic(T* out_items, size_t count)
+        {
+            if (PushMode == RingBufferMode::SPSC)
+            {
+                return pop_n(out_items, count);
+            }
+
+            Internal::Utils::ScopedInterruptLock lock{};
+            return pop_n(out_items, count);
+        }
+
         /**
          * Access a mutable reference to the element at the specified index.
          * CAUTION: Undefined behavior if out of bounds. Always ensure
@@ -266,7 +578,7 @@ namespace DuinoCollections
          */
         T& at(size_t index)
         {
-            return _data[physical_index(index)];
+            return _storage.data()[physical_index(index)];
         }
 
         /**
@@ -278,7 +590,7 @@ namespace DuinoCollections
          */
         const T& at(size_t index) const
         {
-            return _data[physical_index(index)];
+            return _storage.data()[physical_index(index)];
         }
 
         T& operator [](size_t index)
@@ -297,7 +609,7 @@ namespace DuinoCollections
          */
         T& front(void)
         {
-            return _data[_head];
+            return _storage.data()[physical(_head.load_relaxed())];
         }
 
         /**
@@ -306,7 +618,7 @@ namespace DuinoCollections
          */
         const T& front(void) const
         {
-            return _data[_head];
+            return _storage.data()[physical(_head.load_relaxed())];
         }
 
         /**
@@ -315,7 +627,7 @@ namespace DuinoCollections
          */
         T& back(void)
         {
-            return _data[prev(_tail)];
+            return _storage.data()[physical(prev(_tail.load_acquire()))];
         }
 
         /**
@@ -324,7 +636,7 @@ namespace DuinoCollections
          */
         const T& back(void) const
         {
-            return _data[prev(_tail)];
+            return _storage.data()[physical(prev(_tail.load_acquire()))];
         }
 
         // ---------------------------------------------------------------------
@@ -345,18 +657,20 @@ namespace DuinoCollections
              */
             RingBufferIterator(FixedRingBuffer* buffer, size_t index)
                 : _buffer{ buffer }, _index{ index }
+                , _physical{ buffer->is_valid() ? buffer->physical_index(index) : 0 }
             {
                 // Empty body.
             }
 
             T& operator*(void)
             {
-                return _buffer->at(_index);
+                return _buffer->_storage.data()[_physical];
             }
 
             RingBufferIterator& operator++(void)
             {
                 _index++;
+                _physical = _buffer->physical(_physical + 1);
                 return *this;
             }
 
@@ -368,6 +682,7 @@ namespace DuinoCollections
         private:
             FixedRingBuffer* _buffer{ };
             size_t _index{ };
+            size_t _physical{ };
         };
 
         /**
@@ -384,18 +699,20 @@ namespace DuinoCollections
              */
             ConstRingBufferIterator(const FixedRingBuffer* buffer, size_t index)
                 : _buffer{ buffer }, _index{ index } 
+                , _physical{ buffer->is_valid() ? buffer->physical_index(index) : 0 }
             {
                 // Empty body.
             }
 
             const T& operator*(void) const
             {
-                return _buffer->at(_index);
+                return _buffer->_storage.data()[_physical];
             }
 
             ConstRingBufferIterator& operator++(void)
             {
                 _index++;
+                _physical = _buffer->physical(_physical + 1);
                 return *this;
             }
 
@@ -407,6 +724,7 @@ namespace DuinoCollections
         private:
             const FixedRingBuffer* _buffer;
             size_t _index;
+            size_t _physical;
         };
 
         RingBufferIterator begin()
@@ -440,25 +758,175 @@ namespace DuinoCollections
         }
 
     private:
+        // Only SPSC needs synchronized indexes, other modes keep plain ones.
+        using Index = typename Internal::Utils::Conditional<
+            PushMode == RingBufferMode::SPSC,
+            Internal::Utils::AtomicIndex,
+            Internal::Utils::PlainIndex
+        >::type;
+
+        // _head and _tail run over [0, 2 * capacity) so that a full buffer
+        // (distance == capacity) differs from an empty one (distance == 0)
+        // without a shared element count.
+        // No division is ever performed: power-of-two capacities wrap with
+        // mask(), other capacities with a single compare. Inline storage
+        // folds both at compile time.
+        size_t mask(void) const
+        {
+            auto cap = capacity();
+            return cap != 0 && (cap & (cap - 1)) == 0 ? (cap << 1) - 1 : 0;
+        }
+
         size_t next(size_t index) const
         {
-            return (index + 1) % _capacity;
+            auto wrap = mask();
+            if (wrap != 0)
+            {
+                return (index + 1) & wrap;
+            }
+            return index + 1 == (capacity() << 1) ? 0 : index + 1;
         }
 
         size_t prev(size_t index) const
         {
-            return (index + _capacity - 1) % _capacity;
+            auto wrap = mask();
+            if (wrap != 0)
+            {
+                return (index - 1) & wrap;
+            }
+            return index == 0 ? (capacity() << 1) - 1 : index - 1;
+        }
+
+        // count must not exceed capacity.
+        size_t advance(size_t index, size_t count) const
+        {
+            auto wrap = mask();
+            if (wrap != 0)
+            {
+                return (index + count) & wrap;
+            }
+            index += count;
+            return index >= (capacity() << 1) ? index - (capacity() << 1) : index;
+        }
+
+        size_t distance(size_t head, size_t tail) const
+        {
+            auto wrap = mask();
+            if (wrap != 0)
+            {
+                return (tail - head) & wrap;
+            }
+            return tail >= head ? tail - head : tail + (capacity() << 1) - head;
+        }
+
+        // Maps any index in [0, 2 * capacity) to its storage slot.
+        size_t physical(size_t index) const
+        {
+            auto wrap = mask();
+            if (wrap != 0)
+            {
+                return index & (wrap >> 1);
+            }
+            return index >= capacity() ? index - capacity() : index;
         }
 
         size_t physical_index(size_t logical_index) const
         {
-            return (_head + logical_index) % _capacity;
+            return physical(physical(_head.load_relaxed()) + logical_index);
         }
 
-        T* _data{ };
-        size_t _capacity{ };
-        size_t _size{ };
-        size_t _head{ }; // oldest element
-        size_t _tail{ }; // next write position
+        // Constructs an item at the end from args (item to copy or move,
+        // or constructor arguments).
+        template<typename... Args>
+        bool push_item(Args&&... args)
+        {
+            if (!is_valid())
+            {
+                return false;
+            }
+
+            auto tail = _tail.load_relaxed();
+            auto head = _head.load_acquire();
+            if (distance(head, tail) >= capacity())
+            {
+                if (PushMode != RingBufferMode::OVERWRITE)
+                {
+                    return false;
+                }
+
+                Internal::Utils::destroy_at(_storage.data() + physical(head));
+                _head.store_relaxed(next(head));
+            }
+
+            Internal::Utils::construct_at(_storage.data() + physical(tail),
+                Internal::Utils::forward<Args>(args)...);
+            _tail.store_release(next(tail));
+            return true;
+        }
+
+        // Copy-constructs count items into the raw storage from slot start,
+        // wrapping once at most.
+        void write_block(size_t start, const T* items, size_t count)
+        {
+            auto first = capacity() - start;
+            if (first > count)
+            {
+                first = count;
+            }
+            Internal::Utils::construct_elements(_storage.data() + start, items, first);
+            Internal::Utils::construct_elements(_storage.data(), items + first, count - first);
+        }
+
+        // Copies count items out of the storage from slot start, wrapping once at most.
+        void read_block(size_t start, T* out_items, size_t count) const
+        {
+            auto first = capacity() - start;
+            if (first > count)
+            {
+                first = count;
+            }
+            Internal::Utils::copy_elements(out_items, _storage.data() + start, first);
+            Internal::Utils::copy_elements(out_items + first, _storage.data(), count - first);
+        }
+
+        // Destroys count elements from logical index head, wrapping once at most.
+        void destroy_block(size_t head, size_t count)
+        {
+            auto start = physical(head);
+            auto first = capacity() - start;
+            if (first > count)
+            {
+                first = count;
+            }
+            Internal::Utils::destroy_elements(_storage.data() + start, first);
+            Internal::Utils::destroy_elements(_storage.data(), count - first);
+        }
+
+        // Completes a move from other once storage and indexes are transferred.
+        // Heap storage hands its array over, inline storage cannot: live
+        // elements are relocated to the same slots of this FixedRingBuffer.
+        void take_elements(FixedRingBuffer& other)
+        {
+            if (Storage::IS_INLINE)
+            {
+                auto start = physical(_head.load_relaxed());
+                auto count = distance(_head.load_relaxed(), _tail.load_relaxed());
+                auto first = capacity() - start;
+                if (first > count)
+                {
+                    first = count;
+                }
+                Internal::Utils::relocate_elements(_storage.data() + start, other._storage.data() + start, first);
+                Internal::Utils::relocate_elements(_storage.data(), other._storage.data(), count - first);
+            }
+            other._head.store_relaxed(0);
+            other._tail.store_relaxed(0);
+        }
+
+        using Storage = Internal::Policy::Storage::StoragePolicy<T, Capacity>;
+
+        Storage _storage;
+        Index _head{ };     // oldest element
+        Index _tail{ };     // next write position
     };
 }
\ No newline at end of file
@@ -29,18 +29,23 @@ namespace DuinoCollections
      * Fixed-size, sequential and non-ordered container that does not allow
      * duplicates. Elements can be accessed through their index, but not
      * modified.
-     * @param T type of element. Can be any type as long as it has a default
-     *        initializer and implements equality operators == and !=.
+     * @param T type of element. Can be any movable type as long as it
+     *        implements equality operators == and !=.
+     * @param Capacity if not 0, elements are stored inline (no heap
+     *        allocation) and the capacity is fixed at compile time.
+     *        Defaulted to 0: capacity is provided at construction.
      */
-    template<typename T>
+    template<typename T, size_t Capacity = 0>
     class FixedSet : public Internal::LinearCollection<
         T, Internal::Policy::Indexing::SequentialIndexingPolicy<T>,
-        Internal::Policy::Duplication::DuplicationPolicy::FORBID_DUPLICATES
+        Internal::Policy::Duplication::DuplicationPolicy::FORBID_DUPLICATES,
+        Capacity
     >
     {
         using Base = Internal::LinearCollection<
             T, Internal::Policy::Indexing::SequentialIndexingPolicy<T>,
-            Internal::Policy::Duplication::DuplicationPolicy::FORBID_DUPLICATES
+            Internal::Policy::Duplication::DuplicationPolicy::FORBID_DUPLICATES,
+            Capacity
         >;
 
     public:
@@ -48,9 +53,9 @@ namespace DuinoCollections
          * Initializes this FixedSet with the provided maximum capacity.
          * If no capacity is provided, it shall be defaulted to 5.
          * @param max_capacity number of elements this FixedSet can contain at most.
-         *        Defaulted to 5.
+         *        Defaulted to 5. Ignored if Capacity is not 0.
          */
-        FixedSet(size_t max_capacity = 5) : Base{ max_capacity }
+        FixedSet(size_t max_capacity = Capacity > 0 ? Capacity : 5) : Base{ max_capacity }
         {
             // Empty body.
         }
@@ -67,6 +72,28 @@ namespace DuinoCollections
             return Base::push(item);
         }
 
+        /**
+         * Moves the provided item into this FixedSet, see insert(const T&).
+         * @param item to insert.
+         * @return true if insertion was successful, false otherwise.
+         */
+        bool insert(T&& item)
+        {
+            return Base::push(Internal::Utils::move(item));
+        }
+
+        /**
+         * Builds an item from the provided arguments and inserts it into this
+         * FixedSet, see insert(const T&).
+         * @param args arguments forwarded to the constructor of T.
+         * @return true if insertion was successful, false otherwise.
+         */
+        template<typename... Args>
+        bool emplace(Args&&... args)
+        {
+            return Base::emplace(Internal::Utils::forward<Args>(args)...);
+        }
+
         /**
          * Inserts the provided item at the provided index. Insertion may fail if
          * the collection is already at full capacity, if index is out of bounds
@@ -81,6 +108,18 @@ namespace DuinoCollections
             return Base::insert_at(item, index);
         }
 
+        /**
+         * Moves the provided item to the provided index, see
+         * insert_at(const T&, size_t).
+         * @param item to insert.
+         * @param index where the insertion should occur.
+         * @return true if insertion was successful, false otherwise.
+         */
+        bool insert_at(T&& item, size_t index)
+        {
+            return Base::insert_at(Internal::Utils::move(item), index);
+        }
+
         /**
          * Removes item from this FixedSet. Removal may fail if the collection
          * is empty (i.e. contains no element) or if item is not present.
@@ -0,0 +1,346 @@
+/*
+ ******************************************************************************
+ *  FixedSplitMap.hpp
+ *
+ *  Fixed-size Map with separate key and value arrays for the Arduino
+ *  environment.
+ *
+ *  Author: Pierre DEBAS
+ *  Copyright (c) 2026
+ *
+ *  MIT License
+ *  https://github.com/Pierrolefou881/DuinoCollections
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Description:
+ *    Fixed-size, array-backed Map implementation storing keys and values in
+ *    parallel arrays (struct of arrays) for Arduino compatible boards. Part
+ *    of the DuinoCollections library.
+ *
+ ******************************************************************************
+ */
+#pragma once
+#include <stddef.h>
+#include "SortingOrder.hpp"
+#include "internal/utils/Memory.hpp"
+#include "internal/utils/TypeTraits.hpp"
+#include "internal/policy/storage/StoragePolicy.hpp"
+#include "internal/policy/indexing/OrderedIndexingPolicy.hpp"
+#include "internal/policy/indexing/SequentialIndexingPolicy.hpp"
+
+namespace DuinoCollections
+{
+    /**
+     * Fixed-size collection of values indexed by a unique key, sorted by key.
+     * Same behavior as FixedMap, but keys and values are kept in two parallel
+     * arrays instead of an array of KeyValues: the binary search only reads
+     * the dense key array, and insertions and removals shift each array on its
+     * own. Prefer it over FixedMap when values are large compared to keys.
+     *
+     * Entries are accessed through their index with key_at() and value_at().
+     * @param K type of key. Must implement equality operators == and != and
+     *        comparison operators <, <=, >, >=. Usually integral (int, uint,
+     *        size_t...).
+     * @param V type of value. Any movable type, no default initializer is
+     *        required.
+     * @param Capacity if not 0, keys and values are stored inline (no heap
+     *        allocation) and the capacity is fixed at compile time.
+     *        Defaulted to 0: capacity is provided at construction.
+     */
+    template<typename K, typename V, size_t Capacity = 0>
+    class FixedSplitMap
+    {
+    public:
+        /**
+         * Initializes this FixedSplitMap with the provided maximum capacity.
+         * If no capacity is provided, it shall be defaulted to 5.
+         * @param max_capacity maximum number of entries this FixedSplitMap can
+         *        contain. Defaulted to 5. Ignored if Capacity is not 0.
+         */
+        explicit FixedSplitMap(size_t max_capacity = Capacity > 0 ? Capacity : 5)
+            : _keys{ max_capacity }
+            , _values{ max_capacity }
+        {
+            // Empty body.
+        }
+
+        ~FixedSplitMap(void)
+        {
+            clear();
+        }
+
+        // Forbid copy to avoid double free.
+        FixedSplitMap(const FixedSplitMap&) = delete;
+        FixedSplitMap& operator=(const FixedSplitMap&) = delete;
+
+        FixedSplitMap(FixedSplitMap&& other) noexcept
+            : _keys{ Internal::Utils::move(other._keys) }
+            , _values{ Internal::Utils::move(other._values) }
+            , _size{ other._size }
+        {
+            take_entries(other);
+        }
+
+        FixedSplitMap& operator=(FixedSplitMap&& other) noexcept
+        {
+            if (this != &other)
+            {
+                clear();
+                _keys = Internal::Utils::move(other._keys);
+                _values = Internal::Utils::move(other._values);
+                _size = other._size;
+                take_entries(other);
+            }
+            return *this;
+        }
+
+        /**
+         * Adds the provided item and indexes it with the provided key.
+         * Add may fail if this FixedSplitMap is already at full capacity
+         * (size == max capacity) or if key already in use.
+         * @param key must be unique, i.e. not already in use.
+         * @param value can be any value supported by the type V.
+         * @return true if add was successful, false otherwise.
+         */
+        bool add(const K& key, const V& value)
+        {
+            return insert_entry(key, value);
+        }
+
+        /**
+         * Moves the provided value into this FixedSplitMap and indexes it with
+         * the provided key, see add(const K&, const V&). value is left
+         * untouched on failure.
+         * @param key must be unique, i.e. not already in use.
+         * @param value to move into this FixedSplitMap.
+         * @return true if add was successful, false otherwise.
+         */
+        bool add(const K& key, V&& value)
+        {
+            return insert_entry(key, Internal::Utils::move(value));
+        }
+
+        /**
+         * Builds a value in place from the provided arguments and indexes it
+         * with the provided key, see add(const K&, const V&).
+         * @param key must be unique, i.e. not already in use.
+         * @param args arguments forwarded to the constructor of V.
+         * @return true if emplace was successful, false otherwise.
+         */
+        template<typename... Args>
+        bool emplace(const K& key, Args&&... args)
+        {
+            return insert_entry(key, Internal::Utils::forward<Args>(args)...);
+        }
+
+        /**
+         * Removes the item indexed by the provided key from this FixedSplitMap
+         * and frees the key. Removal may fail if this FixedSplitMap has no
+         * element (i.e. is empty) or if key is not used.
+         * @param key indexing the item to remove.
+         * @param out_val value removed and moved out of this FixedSplitMap, if
+         *        found (out parameter).
+         * @return true if removal was successful, false otherwise.
+         */
+        bool remove(const K& key, V& out_val)
+        {
+            auto index = find(key);
+            if (index == _size)
+            {
+                return false;
+            }
+
+            out_val = Internal::Utils::move(_values.data()[index]);
+            KeyIndexing().remove(_keys.data(), _size, index);
+            ValueIndexing().remove(_values.data(), _size, index);
+            _size--;
+            return true;
+        }
+
+        /**
+         * Fetches the value indexed by the provided key without removing it
+         * from this FixedSplitMap.
+         * @param key indexing the item to find.
+         * @param out_val item, if found (out parameter).
+         * @return true if item found, false otherwise.
+         */
+        bool try_get(const K& key, V& out_val) const
+        {
+            auto index = find(key);
+            bool is_found = index != _size;
+            if (is_found)
+            {
+                out_val = _values.data()[index];
+            }
+            return is_found;
+        }
+
+        /**
+         * Determines the index of the provided key, if any.
+         * Only the key array is searched.
+         * @param key to find in this FixedSplitMap.
+         * @return the index of key, or size() if not found.
+         */
+        size_t find(const K& key) const
+        {
+            if (!is_valid())
+            {
+                return _size;
+            }
+            return KeyIndexing().find_index(_keys.data(), _size, key);
+        }
+
+        /**
+         * Determines whether a key is in use in this FixedSplitMap.
+         * @param key to check the presence of.
+         * @return true if key present, false otherwise.
+         */
+        [[nodiscard]]
+        bool contains(const K& key) const
+        {
+            return find(key) != _size;
+        }
+
+        /**
+         * Access the key at the given index. Keys are sorted in ascending order.
+         * CAUTION: Undefined behavior if out of bounds. Always ensure
+         * index <  size().
+         * @param index of the entry to access.
+         * @return the reference to the key at index.
+         */
+        const K& key_at(size_t index) const
+        {
+            return _keys.data()[index];
+        }
+
+        /**
+         * Access the value at the given index.
+         * CAUTION: Undefined behavior if out of bounds. Always ensure
+         * index <  size().
+         * @param index of the entry to access.
+         * @return the reference to the value at index.
+         */
+        V& value_at(size_t index)
+        {
+            return _values.data()[index];
+        }
+
+        /**
+         * Access the value at the given index.
+         * CAUTION: Undefined behavior if out of bounds. Always ensure
+         * index <  size().
+         * @param index of the entry to access.
+         * @return the reference to the value at index.
+         */
+        const V& value_at(size_t index) const
+        {
+            return _values.data()[index];
+        }
+
+        /**
+         * Removes all items from this FixedSplitMap. Every key and value is
+         * destroyed, memory is not actually freed.
+         */
+        void clear(void)
+        {
+            KeyIndexing().clear(_keys.data(), _size);
+            ValueIndexing().clear(_values.data(), _size);
+            _size = 0;
+        }
+
+        /**
+         * @return true if the storage is usable, false otherwise.
+         *         Always true if the storage is inline.
+         */
+        [[nodiscard]]
+        bool is_valid(void) const
+        {
+            return _keys.is_valid() && _values.is_valid();
+        }
+
+        /**
+         * @return the maximum number of entries this FixedSplitMap can contain.
+         */
+        [[nodiscard]]
+        size_t capacity(void) const
+        {
+            return is_valid() ? _keys.capacity() : 0;
+        }
+
+        /**
+         * @return the number of entries contained in this FixedSplitMap.
+         */
+        [[nodiscard]]
+        size_t size(void) const
+        {
+            return _size;
+        }
+
+        /**
+         * @return true if this FixedSplitMap has reached its max capacity,
+         *         false otherwise.
+         */
+        [[nodiscard]]
+        bool is_full(void) const
+        {
+            return _size >= capacity();
+        }
+
+        /**
+         * @return true if this FixedSplitMap contains no element, false otherwise.
+         */
+        [[nodiscard]]
+        bool is_empty(void) const
+        {
+            return _size == 0;
+        }
+
+    private:
+        using KeyIndexing = Internal::Policy::Indexing::OrderedIndexingPolicy<K, Ascending<K>>;
+        using ValueIndexing = Internal::Policy::Indexing::SequentialIndexingPolicy<V>;
+
+        // Constructs the value from args (value to copy or move, or
+        // constructor arguments) at the sorted position of key. The search
+        // only reads keys, then each array is shifted on its own.
+        template<typename... Args>
+        bool insert_entry(const K& key, Args&&... args)
+        {
+            if (!is_valid() || is_full())
+            {
+                return false;
+            }
+
+            auto res = KeyIndexing().find_insert_position(_keys.data(), _size, key);
+            if (res.found)
+            {
+                return false;
+            }
+
+            KeyIndexing().insert(_keys.data(), _size, res.index, key);
+            ValueIndexing().insert(_values.data(), _size, res.index, Internal::Utils::forward<Args>(args)...);
+            _size++;
+            return true;
+        }
+
+        // Completes a move from other once storages and size are transferred.
+        // Heap storage hands its arrays over, inline storage cannot: live
+        // entries are relocated into this FixedSplitMap's own arrays.
+        void take_entries(FixedSplitMap& other)
+        {
+            if (Keys::IS_INLINE)
+            {
+                Internal::Utils::relocate_elements(_keys.data(), other._keys.data(), _size);
+                Internal::Utils::relocate_elements(_values.data(), other._values.data(), _size);
+            }
+            other._size = 0;
+        }
+
+        using Keys = Internal::Policy::Storage::StoragePolicy<K, Capacity>;
+        using Values = Internal::Policy::Storage::StoragePolicy<V, Capacity>;
+
+        Keys _keys;
+        Values _values;
+        size_t _size{ };
+    };
+}
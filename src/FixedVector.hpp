@@ -30,18 +30,23 @@ namespace DuinoCollections
      * Unordered collection of items that allows duplicates.
      * FixedVector can either be used as an array of items or
      * as a stack.
-     * @param T can be any type as long as it implements a
-     *        default initializer.
+     * @param T can be any movable type. No default initializer is
+     *        required, elements are constructed in place.
+     * @param Capacity if not 0, elements are stored inline (no heap
+     *        allocation) and the capacity is fixed at compile time.
+     *        Defaulted to 0: capacity is provided at construction.
      */
-    template<typename T>
+    template<typename T, size_t Capacity = 0>
     class FixedVector : public Internal::LinearCollection<
         T, Internal::Policy::Indexing::SequentialIndexingPolicy<T>, 
-        Internal::Policy::Duplication::DuplicationPolicy::ALLOW_DUPLICATES
+        Internal::Policy::Duplication::DuplicationPolicy::ALLOW_DUPLICATES,
+        Capacity
     > 
     {
         using Base = Internal::LinearCollection<
         T, Internal::Policy::Indexing::SequentialIndexingPolicy<T>,
-        Internal::Policy::Duplication::DuplicationPolicy::ALLOW_DUPLICATES
+        Internal::Policy::Duplication::DuplicationPolicy::ALLOW_DUPLICATES,
+        Capacity
         >;
         
     public:
@@ -50,8 +55,9 @@ namespace DuinoCollections
          * the provided max capacity. If none is provided, a default
          * value shall be assigned.
          * @param max_capacity of this FixedVector. Defaulted to 5.
+         *        Ignored if Capacity is not 0.
          */
-        FixedVector(size_t max_capacity = 5) : Base{ max_capacity }
+        FixedVector(size_t max_capacity = Capacity > 0 ? Capacity : 5) : Base{ max_capacity }
         {
             // Empty body.
         }
@@ -68,10 +74,34 @@ namespace DuinoCollections
             return Base::push(item);
         }
 
+        /**
+         * Moves the provided item into this FixedVector. Gives feedback
+         * upon success or failure. item is left untouched on failure.
+         * @param item to add to this FixedVector.
+         * @return true if push was successful, false otherwise.
+         */
+        bool push(T&& item)
+        {
+            return Base::push(Internal::Utils::move(item));
+        }
+
+        /**
+         * Builds an item from the provided arguments at the end of this
+         * FixedVector. Gives feedback upon success or failure.
+         * @param args arguments forwarded to the constructor of T.
+         * @return true if emplace was successful, false otherwise.
+         */
+        template<typename... Args>
+        bool emplace(Args&&... args)
+        {
+            return Base::emplace(Internal::Utils::forward<Args>(args)...);
+        }
+
         /**
          * Removes the item at the index determined by the FixedVector. Gives
          * feedback on success or failure.
-         * @param out_value removed item (out parameter).
+         * @param out_value removed item, moved out of this FixedVector
+         *        (out parameter).
          * @return true if pop was successful, false otherwise.
          */
         bool pop(T& out_value)
@@ -103,6 +133,19 @@ namespace DuinoCollections
             return Base::push_atomic(item);
         }
 
+        /**
+         * Atomically moves an item into the collection, see push_atomic(const T&).
+         * @param item Item to move into the collection.
+         * @return true if the item was successfully added, false otherwise.
+         *
+         * @warning This method must NOT be called from within an ISR, as it will
+         * re-enable interrupts when exiting the critical section.
+         */
+        bool push_atomic(T&& item)
+        {
+            return Base::push_atomic(Internal::Utils::move(item));
+        }
+
         /**
          * Atomically removes an item from the collection.
          *
@@ -141,6 +184,18 @@ namespace DuinoCollections
             return Base::insert_at(item, index);
         }
 
+        /**
+         * Moves the provided item to the provided index, if possible.
+         * See insert_at(const T&, size_t).
+         * @param item to insert.
+         * @param index of insertion. Must be within bounds.
+         * @return true if insertion successful, false otherwise.
+         */
+        bool insert_at(T&& item, size_t index)
+        {
+            return Base::insert_at(Internal::Utils::move(item), index);
+        }
+
         /**
          * Removes the first occurrence of the provided item from this
          * FixedVector. Removal may fail if item not present.
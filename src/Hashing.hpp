@@ -0,0 +1,58 @@
+/*
+ ******************************************************************************
+ *  Hashing.hpp
+ *
+ *  Hash functors to be used in hashed collections.
+ *
+ *  Author: Pierre DEBAS
+ *  Copyright (c) 2026
+ *
+ *  MIT License
+ *  https://github.com/Pierrolefou881/DuinoCollections
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Description:
+ *    Hash functors to be used by hashed collections. Can be used to
+ *    initialize templates with hashed collections. Any functor with a
+ *    size_t operator()(const T&) const can be used instead (constexpr
+ *    for ConstHashMap).
+ *
+ *    ex:
+ *      FixedHashSet<uint16_t, IntegralHash<uint16_t>> ids{ 256 };
+ *
+ ******************************************************************************
+ */
+#pragma once
+#include <stddef.h>
+
+namespace DuinoCollections
+{
+    /**
+     * Hash functor for integral types (char, int, uint8_t, enum...).
+     * Hashed tables index with the low bits of the hash: the value is
+     * mixed so that keys differing only in their high bits (e.g. IDs
+     * sharing a low byte) still spread over the table.
+     *
+     * example:
+     *      FixedHashSet<uint32_t, IntegralHash<uint32_t>> ids{ 128 };
+     *
+     * @param T integral type, or any type convertible to size_t.
+     *          Bits that do not fit in a size_t are ignored.
+     */
+    template<typename T>
+    struct IntegralHash
+    {
+        constexpr size_t operator()(const T& value) const
+        {
+            return fold(fold(static_cast<size_t>(value)) * static_cast<size_t>(0x9E3779B9UL));
+        }
+
+    private:
+        // Mixes the high half of hash into its low half.
+        static constexpr size_t fold(size_t hash)
+        {
+            return hash ^ (hash >> (sizeof(size_t) * 4));
+        }
+    };
+}
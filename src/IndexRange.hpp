@@ -0,0 +1,52 @@
+/*
+ ******************************************************************************
+ *  IndexRange.hpp
+ *
+ *  Range of positions returned by ordered collection queries.
+ *
+ *  Author: Pierre DEBAS
+ *  Copyright (c) 2026
+ *
+ *  MIT License
+ *  https://github.com/Pierrolefou881/DuinoCollections
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Description:
+ *    Result of equal_range and range on FixedOrderedVector, FixedOrderedSet
+ *    and FixedMap. Part of the DuinoCollections library.
+ *
+ ******************************************************************************
+ */
+#pragma once
+#include <stddef.h>
+
+namespace DuinoCollections
+{
+    /**
+     * Half-open range [first, last) of positions in sorting order. Only
+     * holds two indices: elements are not copied, they are read with
+     * select() (or operator[] if the collection is not frozen).
+     */
+    struct IndexRange
+    {
+        size_t first;
+        size_t last;
+
+        /**
+         * @return the number of positions in this IndexRange.
+         */
+        size_t size(void) const
+        {
+            return last - first;
+        }
+
+        /**
+         * @return true if this IndexRange holds no position, false otherwise.
+         */
+        bool is_empty(void) const
+        {
+            return first == last;
+        }
+    };
+}
@@ -0,0 +1,144 @@
+/*
+ ******************************************************************************
+ *  KeyValue.hpp
+ *
+ *  Key / value association stored by map collections.
+ *
+ *  Author: Pierre DEBAS
+ *  Copyright (c) 2026
+ *
+ *  MIT License
+ *  https://github.com/Pierrolefou881/DuinoCollections
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Description:
+ *    Element type of FixedMap and FixedHashMap. Part of the
+ *    DuinoCollections library.
+ *
+ ******************************************************************************
+ */
+#pragma once
+#include "internal/utils/TypeTraits.hpp"
+
+namespace DuinoCollections
+{
+    /**
+     * Data element to be used in FixedMap and FixedHashMap, associates a
+     * unique, comparable key with a value.
+     * @param K type of key. Must have a default initializer and must
+     *        implement equality operators == and != and comparison
+     *        operators <, <=, >, >=. Usually integral (int, uint, size_t...).
+     * @param V type of value. A default initializer is only required
+     *        by KeyValue(void).
+     */
+    template<typename K, typename V>
+    struct KeyValue
+    {
+        K key{ };
+        V value{ };
+
+        /**
+         * Initializes this KeyValue as a default one.
+         */
+        KeyValue(void) = default;
+
+        /**
+         * Initializes this KeyValue with the provided
+         * key and value.
+         * @param a_key must be unique.
+         * @param a_value can be any value of its type.
+         */
+        explicit KeyValue(const K& a_key, const V& a_value)
+            : key{ a_key }, value{ a_value}
+        {
+            // Empty body.
+        }
+
+        /**
+         * Initializes this KeyValue with the provided
+         * key and moves the provided value into it.
+         * @param a_key must be unique.
+         * @param a_value can be any value of its type.
+         */
+        explicit KeyValue(const K& a_key, V&& a_value)
+            : key{ a_key }, value{ Internal::Utils::move(a_value) }
+        {
+            // Empty body.
+        }
+
+        /**
+         * Initializes this KeyValue with the provided key and builds its
+         * value in place from the provided arguments.
+         * @param a_key must be unique.
+         * @param args arguments forwarded to the constructor of V.
+         */
+        template<typename... Args>
+        explicit KeyValue(const K& a_key, Args&&... args)
+            : key{ a_key }, value(Internal::Utils::forward<Args>(args)...)
+        {
+            // Empty body.
+        }
+
+        friend bool operator ==(const KeyValue<K, V>& a, const KeyValue<K, V>& b)
+        {
+            return a.key == b.key;
+        }
+
+        friend bool operator !=(const KeyValue<K, V>& a, const KeyValue<K, V>& b)
+        {
+            return !(a == b);
+        }
+
+        friend bool operator >(const KeyValue<K, V>& a, const KeyValue<K, V>& b)
+        {
+            return a.key > b.key;
+        }
+
+        friend bool operator >=(const KeyValue<K, V>& a, const KeyValue<K, V>& b)
+        {
+            return a > b || a == b;
+        }
+
+        friend bool operator <(const KeyValue<K, V>& a, const KeyValue<K, V>& b)
+        {
+            return !(a >= b);
+        }
+
+        friend bool operator <=(const KeyValue<K, V>& a, const KeyValue<K, V>& b)
+        {
+            return !(a > b);
+        }
+
+        // Comparisons with a bare key, for lookups without a temporary KeyValue.
+        friend bool operator ==(const KeyValue<K, V>& a, const K& key)
+        {
+            return a.key == key;
+        }
+
+        friend bool operator !=(const KeyValue<K, V>& a, const K& key)
+        {
+            return !(a == key);
+        }
+
+        friend bool operator <(const KeyValue<K, V>& a, const K& key)
+        {
+            return a.key < key;
+        }
+
+        friend bool operator <(const K& key, const KeyValue<K, V>& a)
+        {
+            return key < a.key;
+        }
+
+        friend bool operator >(const KeyValue<K, V>& a, const K& key)
+        {
+            return a.key > key;
+        }
+
+        friend bool operator >(const K& key, const KeyValue<K, V>& a)
+        {
+            return key > a.key;
+        }
+    };
+}
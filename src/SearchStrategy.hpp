@@ -0,0 +1,231 @@
+/*
+ ******************************************************************************
+ *  SearchStrategy.hpp
+ *
+ *  Search strategies to be used in ordered collection indexing policies.
+ *
+ *  Author: Pierre DEBAS
+ *  Copyright (c) 2026
+ *
+ *  MIT License
+ *  https://github.com/Pierrolefou881/DuinoCollections
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Description:
+ *    Lower bound kernels used by OrderedIndexingPolicy to locate items in
+ *    sorted arrays. Can be used to initialize templates with ordered
+ *    collections. Any functor with a
+ *    size_t lower_bound(const T* data, size_t size, const Key& key,
+ *                       const Order& order) const
+ *    can be used instead.
+ *
+ *    ex:
+ *      FixedOrderedSet<int, Ascending<int>, 64, BranchlessSearch> set;
+ *      FixedMap<uint32_t, int, 128, InterpolationSearch> log;
+ *
+ ******************************************************************************
+ */
+#pragma once
+#include <stddef.h>
+#include "KeyValue.hpp"
+
+namespace DuinoCollections
+{
+    /**
+     * Classic binary search: halves the range with a branch per probe.
+     * Best choice on cores without branch prediction (AVR) and for small
+     * collections. Default search strategy of ordered collections.
+     *
+     * example:
+     *      FixedOrderedSet<int, Ascending<int>, 0, BinarySearch> set{ 20 };
+     */
+    struct BinarySearch
+    {
+        /**
+         * @param data sorted array.
+         * @param size number of elements in data.
+         * @param key to locate, comparable with T through order.
+         * @param order sorting order of data.
+         * @return the first index where order(data[index], key) is false,
+         *         size if none.
+         */
+        template<typename T, typename Key, typename Order>
+        size_t lower_bound(const T* data, size_t size, const Key& key, const Order& order) const
+        {
+            size_t left = 0;
+            size_t right = size;
+
+            while (left < right)
+            {
+                size_t middle = left + ((right - left) >> 1);
+                if (order(data[middle], key))
+                {
+                    left = middle + 1;
+                }
+                else
+                {
+                    right = middle;
+                }
+            }
+
+            return left;
+        }
+    };
+
+    /**
+     * Branchless binary search: the range always shrinks by half and the
+     * comparison only selects the next base (conditional move), so random
+     * keys do not cause branch mispredictions. The number of probes depends
+     * on size only. Prefer it on pipelined cores (ESP32, RP2040, host)
+     * with random lookups; host builds also prefetch both candidate probes.
+     *
+     * example:
+     *      FixedMap<uint16_t, int, 128, BranchlessSearch> calibration;
+     */
+    struct BranchlessSearch
+    {
+        /**
+         * @param data sorted array.
+         * @param size number of elements in data.
+         * @param key to locate, comparable with T through order.
+         * @param order sorting order of data.
+         * @return the first index where order(data[index], key) is false,
+         *         size if none.
+         */
+        template<typename T, typename Key, typename Order>
+        size_t lower_bound(const T* data, size_t size, const Key& key, const Order& order) const
+        {
+            if (size == 0)
+            {
+                return 0;
+            }
+
+            // Lower bound stays within [base, base + size].
+            const T* base = data;
+            while (size > 1)
+            {
+                size_t half = size >> 1;
+                prefetch(base + (half >> 1));
+                prefetch(base + half + (half >> 1));
+                base = order(base[half], key) ? base + half : base;
+                size -= half;
+            }
+
+            return static_cast<size_t>(base - data) + (order(*base, key) ? 1 : 0);
+        }
+
+    private:
+        static void prefetch(const void* address)
+        {
+#if defined(__GNUC__) && !defined(ARDUINO)
+            __builtin_prefetch(address);
+#else
+            (void)address;
+#endif
+        }
+    };
+
+    /**
+     * Interpolation search for arithmetic elements (and KeyValues with
+     * arithmetic keys): each probe is placed where the key should be if
+     * values were evenly spaced between both ends of the range. Evenly
+     * spaced keys (timestamps, ADC codes...) are found in about two probes
+     * instead of log2(n). As soon as a probe fails to halve the range, or
+     * when few elements remain, the search falls back to BinarySearch, so
+     * the worst case stays O(log n) plus a few probes.
+     *
+     * Estimates are computed with double: prefer cores with a floating
+     * point unit, or large collections where each saved probe is worth it.
+     *
+     * example:
+     *      FixedOrderedVector<uint32_t, Ascending<uint32_t>, 256, InterpolationSearch> timestamps;
+     */
+    struct InterpolationSearch
+    {
+        // Ranges at most this long are handed over to BinarySearch.
+        static const size_t MIN_INTERPOLATED_RANGE{ 8 };
+
+        /**
+         * @param data sorted array of arithmetic values, or of KeyValues
+         *        with arithmetic keys.
+         * @param size number of elements in data.
+         * @param key to locate, comparable with T through order.
+         * @param order sorting order of data.
+         * @return the first index where order(data[index], key) is false,
+         *         size if none.
+         */
+        template<typename T, typename Key, typename Order>
+        size_t lower_bound(const T* data, size_t size, const Key& key, const Order& order) const
+        {
+            // Lower bound stays within [left, right].
+            size_t left = 0;
+            size_t right = size;
+            while (right - left > MIN_INTERPOLATED_RANGE)
+            {
+                if (!order(data[left], key))
+                {
+                    return left;
+                }
+                if (order(data[right - 1], key))
+                {
+                    return right;
+                }
+
+                // data[left] comes before key, data[right - 1] does not.
+                auto low = value_of(data[left]);
+                auto high = value_of(data[right - 1]);
+                if (high == low)
+                {
+                    break;
+                }
+
+                // Clamped, as rounding (or NaN) may push the estimate out of range.
+                auto span = right - 1 - left;
+                auto offset = (value_of(key) - low) / (high - low) * static_cast<double>(span);
+                auto probe = left + (offset > 0 ? (offset < span ? static_cast<size_t>(offset) : span) : 0);
+
+                // A probe next to the lower bound ends the search, whichever
+                // side of the range it keeps.
+                auto range = right - left;
+                if (order(data[probe], key))
+                {
+                    if (!order(data[probe + 1], key))
+                    {
+                        return probe + 1;
+                    }
+                    left = probe + 1;
+                }
+                else
+                {
+                    if (probe == left || order(data[probe - 1], key))
+                    {
+                        return probe;
+                    }
+                    right = probe;
+                }
+
+                // Uneven values: the estimate cannot be trusted anymore.
+                if ((right - left) > (range >> 1))
+                {
+                    break;
+                }
+            }
+
+            return left + BinarySearch{ }.lower_bound(data + left, right - left, key, order);
+        }
+
+    private:
+        template<typename U>
+        static double value_of(const U& value)
+        {
+            return static_cast<double>(value);
+        }
+
+        template<typename K, typename V>
+        static double value_of(const KeyValue<K, V>& item)
+        {
+            return static_cast<double>(item.key);
+        }
+    };
+}
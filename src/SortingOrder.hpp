@@ -38,14 +38,29 @@ namespace DuinoCollections
      *          implement equality operators == and != and
      *          comparison operators <, <=, > and >= 
      *          (at least < and > required).
+     *          Lookup keys of another type must be comparable with T
+     *          through the same operators.
      */
     template<typename T>
     struct Ascending
     {
+        // Marks this order as transparent: it compares mixed types.
+        using is_transparent = void;
+
         bool operator()(const T& a, const T& b) const
         {
             return a < b;
         }
+
+        /**
+         * Compares an element with a lookup key of another type (e.g. a
+         * KeyValue with a bare key), without converting either one.
+         */
+        template<typename A, typename B>
+        bool operator()(const A& a, const B& b) const
+        {
+            return a < b;
+        }
     };
 
     /**
@@ -60,13 +75,28 @@ namespace DuinoCollections
      *          implement equality operators == and != and
      *          comparison operators <, <=, > and >= 
      *          (at least < and > required).
+     *          Lookup keys of another type must be comparable with T
+     *          through the same operators.
      */
     template<typename T>
     struct Descending
     {
+        // Marks this order as transparent: it compares mixed types.
+        using is_transparent = void;
+
         bool operator()(const T& a, const T& b) const
         {
             return a > b;
         }
+
+        /**
+         * Compares an element with a lookup key of another type (e.g. a
+         * KeyValue with a bare key), without converting either one.
+         */
+        template<typename A, typename B>
+        bool operator()(const A& a, const B& b) const
+        {
+            return a > b;
+        }
     };
 }
\ No newline at end of file
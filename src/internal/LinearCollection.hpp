@@ -22,8 +22,14 @@
  */
 #pragma once
 #include "policy/duplication/DuplicationPolicy.hpp"
+#include "policy/indexing/BaseShiftIndexingPolicy.hpp"
+#include "policy/indexing/IndexingState.hpp"
+#include "policy/storage/StoragePolicy.hpp"
 #include "utils/ScopedInterruptLock.hpp"
 #include "utils/Iterator.hpp"
+#include "utils/Memory.hpp"
+#include "utils/Sort.hpp"
+#include "utils/TypeTraits.hpp"
 
 namespace DuinoCollections
 {
@@ -35,8 +41,10 @@ namespace DuinoCollections
          * implementations shall:
          * <ul>
          *     <li>Use arrays for data storage.</li>
-         *     <li>Have a fixed maximal capacity and allocate dynamically once 
-         *         at construction time and free memory on destruction.</li>
+         *     <li>Have a fixed maximal capacity and either allocate dynamically
+         *         once at construction time and free memory on destruction, or
+         *         store their elements inline when the capacity is known at
+         *         compile time.</li>
          *     <li>Provide failsafes in case of allocation failure.</li>
          *     <li>Allow indexing but be transparent on potential UBs.</li>
          *     <li>Return feedback on critical operations (push, pop, insert, remove...).</li>
@@ -48,37 +56,46 @@ namespace DuinoCollections
          * collection types provide façade and pick the methods that suit their needs.
          * This architecture allows compile-time polymorphism on performance-critical
          * paths and avoids RAM-expensive virtual tables. 
+         * Elements live in raw storage: each one is constructed in place on
+         * insertion and destroyed on removal, so constructing a LinearCollection
+         * costs O(1) regardless of its capacity.
          * @param T type of data stored in this LinearCollection concrete
-         *        implementation. Can be any type as long as it has a
-         *        default initializer.
+         *        implementation. Can be any movable type, no default
+         *        initializer is required.
          * @param IndexingPolicy defines where insertions should occur.
          * @param DuplicationPolicy defines whether duplicates are allowed or not.
+         * @param Capacity if not 0, elements are stored inline in an array of
+         *        Capacity elements. If 0, the capacity is provided at construction
+         *        and the array is allocated once on the heap.
          */
-        template<typename T, typename IndexingPolicy, Policy::Duplication::DuplicationPolicy Duplication>
-        class LinearCollection
+        template<typename T, typename IndexingPolicy, Policy::Duplication::DuplicationPolicy Duplication,
+            size_t Capacity = 0>
+        class LinearCollection : private Policy::Indexing::IndexingState<IndexingPolicy>
         {    
+            using Indexing = Policy::Indexing::IndexingState<IndexingPolicy>;
+
         public:
-            ~LinearCollection()
+            LinearCollection(const LinearCollection<T, IndexingPolicy, Duplication, Capacity>& other) = delete;
+
+            LinearCollection(LinearCollection<T, IndexingPolicy, Duplication, Capacity>&& other) noexcept
+                : Indexing{ Utils::move(other) }
+                , _storage{ Utils::move(other._storage) }, _size{ other._size }
             {
-                delete[] _data;
+                take_elements(other);
             }
 
-            LinearCollection(const LinearCollection<T, IndexingPolicy, Duplication>& other) = delete;
-
-            LinearCollection(LinearCollection<T, IndexingPolicy, Duplication>&& other) noexcept
-                : _data{ other._data }, _capacity{ other._capacity }, _size{ other._size }
+            ~LinearCollection(void)
             {
-                other._data = nullptr;
-                other._capacity = 0;
-                other._size = 0;
+                clear();
             }
 
             /**
-             * Removes all items from this LinearCollection. Memory is not actually
-             * free, but might be erased later on push or insertion.
+             * Removes all items from this LinearCollection. Every item is destroyed,
+             * memory is not actually freed.
              */
             void clear(void)
             {
+                Indexing::indexing().clear(data(), _size);
                 _size = 0;
             }
 
@@ -87,7 +104,8 @@ namespace DuinoCollections
              * if possible. Removal may fail if this LinearCollection is empty
              * or if index is out of bounds (exceeds or equals _size).
              * @param index where removal should occur.
-             * @param out_item retrieved value, if any (out parameter).
+             * @param out_item retrieved value, if any, moved out of this
+             *        LinearCollection (out parameter).
              * @return true if removal successful, false otherwise.
              */
             bool remove_at(size_t index, T& out_item)
@@ -97,19 +115,20 @@ namespace DuinoCollections
                     return false;
                 }
                 
-                out_item = _data[index];
-                _INDEXING_POLICY.remove(_data, _size, index);
+                out_item = Utils::move(data()[index]);
+                Indexing::indexing().remove(data(), _size, index);
                 _size--;
                 return true;
             }
 
             /**
-             * @return true if _data member is usable, false otherwise.
+             * @return true if the storage is usable, false otherwise.
+             *         Always true if the storage is inline.
              */
             [[nodiscard]]
             bool is_valid(void) const
             {
-                return _data != nullptr;
+                return _storage.is_valid() && Indexing::is_indexing_valid();
             }
             
             /**
@@ -119,7 +138,7 @@ namespace DuinoCollections
             [[nodiscard]]
             size_t capacity(void) const
             {
-                return _capacity;
+                return _storage.capacity();
             }
 
             /**
@@ -139,7 +158,7 @@ namespace DuinoCollections
             [[nodiscard]]
             bool is_full(void) const
             {
-                return _size >= _capacity;
+                return _size >= capacity();
             }
 
             /**
@@ -160,7 +179,7 @@ namespace DuinoCollections
              */
             const T& at(size_t index) const
             {
-                return _data[index];
+                return data()[index];
             }
 
             /**
@@ -171,7 +190,11 @@ namespace DuinoCollections
              */
             size_t find(const T& item) const
             {
-                return _INDEXING_POLICY.find_index(_data, _size, item);
+                if (!is_valid())
+                {
+                    return _size;
+                }
+                return Indexing::indexing().find_index(data(), _size, item);
             }
 
             /**
@@ -191,26 +214,22 @@ namespace DuinoCollections
              */
             const T& operator [](size_t index) const
             {
-                return _data[index];
+                return data()[index];
             }
 
-            LinearCollection<T, IndexingPolicy, Duplication>& operator =(
-                const LinearCollection<T, IndexingPolicy, Duplication>& other) = delete;
+            LinearCollection<T, IndexingPolicy, Duplication, Capacity>& operator =(
+                const LinearCollection<T, IndexingPolicy, Duplication, Capacity>& other) = delete;
 
-            LinearCollection<T, IndexingPolicy, Duplication>& operator =(
-                LinearCollection<T, IndexingPolicy, Duplication>&& other) noexcept
+            LinearCollection<T, IndexingPolicy, Duplication, Capacity>& operator =(
+                LinearCollection<T, IndexingPolicy, Duplication, Capacity>&& other) noexcept
             {
                 if (this != &other)
                 {
-                    delete[] _data;
-
-                    _data = other._data;
-                    _capacity = other._capacity;
+                    clear();
+                    Indexing::operator =(Utils::move(other));
+                    _storage = Utils::move(other._storage);
                     _size = other._size;
-
-                    other._data = nullptr;
-                    other._capacity = 0;
-                    other._size = 0;
+                    take_elements(other);
                 }
 
                 return *this;
@@ -219,12 +238,12 @@ namespace DuinoCollections
             // Iterators (range-for support)
             Utils::ConstIterator<T> begin(void) const
             {
-                return Utils::ConstIterator<T>{ _data };
+                return Utils::ConstIterator<T>{ data() };
             }
 
             Utils::ConstIterator<T> end(void) const
             {
-                return Utils::ConstIterator<T>{ _data + _size };
+                return Utils::ConstIterator<T>{ data() + _size };
             }
 
             Utils::ConstIterator<T> cbegin(void) const
@@ -242,17 +261,16 @@ namespace DuinoCollections
             /**
              * Initializes this LinearCollection with the provided maximum
              * capacity.
-             * @param capacity must be strictly positive. Defaulted to 5.
+             * @param capacity must be strictly positive. Defaulted to 5, or
+             *        to Capacity if the storage is inline (in which case it is
+             *        ignored).
              */
-            explicit LinearCollection(size_t capacity = 5)
-                : _data{ capacity > 0 ? new T[capacity] : nullptr }
-                , _capacity{ capacity }
+            explicit LinearCollection(size_t capacity = Capacity > 0 ? Capacity : 5)
+                : Indexing{ capacity }
+                , _storage{ capacity }
                 , _size{ 0 }
             {
-                if (_data == nullptr)
-                {
-                    _capacity = 0;
-                }
+                // Empty body.
             }
 
             /**
@@ -264,45 +282,81 @@ namespace DuinoCollections
              */
             bool push(const T& item)
             {
-                if (!is_valid() || is_full())
-                {
-                    return false;
-                }
+                return push_item(item);
+            }
 
-                size_t index{ };
-                bool can_add{ };
+            /**
+             * Moves the provided item into this LinearCollection. Gives feedback
+             * upon success or failure. item is left untouched on failure.
+             * @param item to add to this LinearCollection.
+             * @return true if push was successful, false otherwise.
+             */
+            bool push(T&& item)
+            {
+                return push_item(Utils::move(item));
+            }
 
-                // Ordered and does not allow duplicate, avoid double search.
-                if (IndexingPolicy::IS_ORDERED 
-                        && Duplication == Policy::Duplication::DuplicationPolicy::FORBID_DUPLICATES)
-                {
-                    auto res = _INDEXING_POLICY.find_insert_position(_data, _size, item);
-                    index = res.index;
-                    can_add = !res.found;
-                }
+            /**
+             * Copies the provided item into this ordered LinearCollection at the
+             * hinted index, without any search if the hint keeps the order.
+             * Otherwise the index is searched as in push. Requires an ordered
+             * IndexingPolicy.
+             * @param hint expected insertion index.
+             * @param item to add to this LinearCollection.
+             * @return true if push was successful, false otherwise.
+             */
+            bool push_hint(size_t hint, const T& item)
+            {
+                return push_item_hint(hint, item);
+            }
 
-                // Fallback for generic case.
-                else
+            /**
+             * Moves the provided item into this ordered LinearCollection at the
+             * hinted index, see push_hint(size_t, const T&). item is left
+             * untouched on failure.
+             * @param hint expected insertion index.
+             * @param item to add to this LinearCollection.
+             * @return true if push was successful, false otherwise.
+             */
+            bool push_hint(size_t hint, T&& item)
+            {
+                return push_item_hint(hint, Utils::move(item));
+            }
+
+            /**
+             * Builds an item from the provided arguments into this LinearCollection.
+             * Gives feedback upon success or failure.
+             * Unordered collections allowing duplicates build the item in place.
+             * Others need a temporary to search for its position, which is then
+             * moved in.
+             * @param args arguments forwarded to the constructor of T.
+             * @return true if push was successful, false otherwise.
+             */
+            template<typename... Args>
+            bool emplace(Args&&... args)
+            {
+                if (!is_valid() || is_full())
                 {
-                    index = _INDEXING_POLICY.get_push_index(_data, _size, item);
-                    can_add = Duplication == Policy::Duplication::DuplicationPolicy::ALLOW_DUPLICATES
-                           || _INDEXING_POLICY.find_index(_data, _size, item) == _size;
+                    return false;
                 }
 
-                if (!can_add)
+                // No comparison needed, append in place.
+                if (!IndexingPolicy::IS_ORDERED
+                        && Duplication == Policy::Duplication::DuplicationPolicy::ALLOW_DUPLICATES)
                 {
-                    return false;
+                    Indexing::indexing().insert(data(), _size, _size, Utils::forward<Args>(args)...);
+                    _size++;
+                    return true;
                 }
 
-                _INDEXING_POLICY.insert(_data, _size, index, item);
-                _size++;
-                return true;
+                return push_item(T(Utils::forward<Args>(args)...));
             }
 
             /**
              * Removes the item at the index determined by the IndexingPolicy. Gives
              * feedback on success or failure.
-             * @param out_value removed item (out parameter).
+             * @param out_value removed item, moved out of this LinearCollection
+             *        (out parameter).
              * @return true if pop was successful, false otherwise.
              */
             bool pop(T& out_value)
@@ -312,9 +366,9 @@ namespace DuinoCollections
                     return false;
                 }
 
-                auto index = _INDEXING_POLICY.get_pop_index(_data, _size);
-                out_value = _data[index];
-                _INDEXING_POLICY.remove(_data, _size, index);
+                auto index = Indexing::indexing().get_pop_index(data(), _size);
+                out_value = Utils::move(data()[index]);
+                Indexing::indexing().remove(data(), _size, index);
                 _size--;
                 return true;
             }
@@ -344,6 +398,20 @@ namespace DuinoCollections
                 return push(item);
             }
 
+            /**
+             * Atomically moves an item into the collection, see push_atomic(const T&).
+             * @param item Item to move into the collection.
+             * @return true if the item was successfully added, false otherwise.
+             *
+             * @warning This method must NOT be called from within an ISR, as it will
+             * re-enable interrupts when exiting the critical section.
+             */
+            bool push_atomic(T&& item)
+            {
+                Utils::ScopedInterruptLock lock{};
+                return push(Utils::move(item));
+            }
+
             /**
              * Atomically removes an item from the collection.
              *
@@ -380,16 +448,19 @@ namespace DuinoCollections
              */
             bool insert_at(const T& item, size_t index)
             {
-                if (!is_valid() || is_full() || index > _size
-                        || (Duplication == Policy::Duplication::DuplicationPolicy::FORBID_DUPLICATES
-                    && _INDEXING_POLICY.find_index(_data, _size, item) != _size))
-                {
-                    return false;
-                }
+                return insert_item_at(item, index);
+            }
 
-                _INDEXING_POLICY.insert(_data, _size, index, item);
-                _size++;
-                return true;
+            /**
+             * Moves the provided item to the provided index, if possible.
+             * See insert_at(const T&, size_t). item is left untouched on failure.
+             * @param item to insert.
+             * @param index of insertion. Must be within bounds.
+             * @return true if insertion successful, false otherwise.
+             */
+            bool insert_at(T&& item, size_t index)
+            {
+                return insert_item_at(Utils::move(item), index);
             }
 
             /**
@@ -404,13 +475,13 @@ namespace DuinoCollections
                 {
                     return false;
                 }
-                auto index = _INDEXING_POLICY.find_index(_data, _size, item);
+                auto index = Indexing::indexing().find_index(data(), _size, item);
                 if (index == _size)
                 {
                     return false;
                 }
 
-                _INDEXING_POLICY.remove(_data, _size, index);
+                Indexing::indexing().remove(data(), _size, index);
                 _size--;
                 return true;
             }
@@ -428,26 +499,327 @@ namespace DuinoCollections
                     return false;
                 }
 
-                auto count = _INDEXING_POLICY.remove_all(_data, _size, item);
+                auto count = Indexing::indexing().remove_all(data(), _size, item);
                 _size -= count;
                 return count > 0;
             }
 
+            /**
+             * Removes every item from lo (included) to hi (excluded) in
+             * sorting order in one pass, see remove_all. Requires an ordered
+             * IndexingPolicy.
+             * @param lo first key of the range, comparable with T.
+             * @param hi key past the range, comparable with T.
+             * @return the number of items removed.
+             */
+            template<typename Key>
+            size_t erase_key_range(const Key& lo, const Key& hi)
+            {
+                static_assert(IndexingPolicy::IS_ORDERED, "erase_key_range requires an ordered collection");
+                if (!is_valid())
+                {
+                    return 0;
+                }
+
+                auto count = Indexing::indexing().remove_between(data(), _size, lo, hi);
+                _size -= count;
+                return count;
+            }
+
+            /**
+             * Inserts copies of the items of [first, last) in bulk: items are
+             * appended, the whole array is sorted once, then duplicates are
+             * removed if forbidden. Costs O(n log n) instead of O(n²) element
+             * moves for repeated push calls, without any extra buffer.
+             * Requires an ordered IndexingPolicy.
+             *
+             * Items already present are skipped when duplicates are forbidden;
+             * if the range itself holds equal items, which one is kept is
+             * unspecified. Items that do not fit are not inserted.
+             * @param first iterator to the first item to insert.
+             * @param last iterator past the last item to insert.
+             * @return the number of items inserted.
+             */
+            template<typename Iterator>
+            size_t insert_range(Iterator first, Iterator last)
+            {
+                static_assert(IndexingPolicy::IS_ORDERED, "insert_range requires an ordered collection");
+                if (!is_valid())
+                {
+                    return 0;
+                }
+
+                auto initial_size = _size;
+
+                // Another pass only runs if removed duplicates freed room.
+                while (first != last && !is_full())
+                {
+                    auto sorted_size = _size;
+                    for (; first != last && !is_full(); ++first)
+                    {
+                        if (Duplication == Policy::Duplication::DuplicationPolicy::FORBID_DUPLICATES
+                                && Indexing::indexing().find_insert_position(data(), sorted_size, *first).found)
+                        {
+                            continue;
+                        }
+                        Utils::construct_at(data() + _size, *first);
+                        _size++;
+                    }
+
+                    Indexing::indexing().sort(data(), _size);
+                    if (Duplication == Policy::Duplication::DuplicationPolicy::FORBID_DUPLICATES)
+                    {
+                        _size = Utils::unique_elements(data(), _size);
+                    }
+                }
+
+                return _size - initial_size;
+            }
+
+            /**
+             * Determines the index of the first item equivalent to the provided
+             * key, without converting key to T. The IndexingPolicy must accept
+             * Key in find_index (e.g. OrderedIndexingPolicy with a transparent
+             * SortOrder).
+             * @param key to look up, comparable with T.
+             * @return the index of the item, or _size if not found.
+             */
+            template<typename Key>
+            size_t find_key(const Key& key) const
+            {
+                if (!is_valid())
+                {
+                    return _size;
+                }
+                return Indexing::indexing().find_index(data(), _size, key);
+            }
+
+            /**
+             * Specific to ordered policies.
+             * @param key to look up, comparable with T.
+             * @return the index of the first item not coming before key.
+             */
+            template<typename Key>
+            size_t lower_bound_key(const Key& key) const
+            {
+                if (!is_valid())
+                {
+                    return _size;
+                }
+                return Indexing::indexing().lower_bound(data(), _size, key);
+            }
+
+            /**
+             * Specific to ordered policies.
+             * @param key to look up, comparable with T.
+             * @return the index of the first item coming after key.
+             */
+            template<typename Key>
+            size_t upper_bound_key(const Key& key) const
+            {
+                if (!is_valid())
+                {
+                    return _size;
+                }
+                return Indexing::indexing().upper_bound(data(), _size, key);
+            }
+
+            /**
+             * Determines where the provided key would be inserted and whether an
+             * equivalent item is already present, in a single search.
+             * @param key to look up, comparable with T.
+             * @return insertion index and presence of an equivalent item.
+             */
+            template<typename Key>
+            Policy::Indexing::SearchResult find_key_position(const Key& key) const
+            {
+                if (!is_valid())
+                {
+                    return { _size, false };
+                }
+                return Indexing::indexing().find_insert_position(data(), _size, key);
+            }
+
+            /**
+             * Builds an item from the provided arguments at the provided index,
+             * without any search nor duplicate check. The caller guarantees
+             * index keeps the collection consistent (e.g. from find_key_position).
+             * @param index of insertion. Must be within bounds.
+             * @param args arguments forwarded to the constructor of T.
+             * @return true if insertion successful, false otherwise.
+             */
+            template<typename... Args>
+            bool emplace_at(size_t index, Args&&... args)
+            {
+                if (!is_valid() || is_full() || index > _size)
+                {
+                    return false;
+                }
+
+                Indexing::indexing().insert(data(), _size, index, Utils::forward<Args>(args)...);
+                _size++;
+                return true;
+            }
+
+            /**
+             * Removes and destroys the item at provided index, if possible.
+             * Removal may fail if index is out of bounds (exceeds or equals _size).
+             * @param index where removal should occur.
+             * @return true if removal successful, false otherwise.
+             */
+            bool erase_at(size_t index)
+            {
+                if (!is_valid() || index >= _size)
+                {
+                    return false;
+                }
+
+                Indexing::indexing().remove(data(), _size, index);
+                _size--;
+                return true;
+            }
+
+            /**
+             * Sets the number of live items once a derived collection has
+             * constructed or destroyed items itself through data() (bulk
+             * algorithms).
+             * CAUTION: items in [0, new_size) must be live and the others raw.
+             * @param new_size number of live items, at most capacity().
+             */
+            void set_size(size_t new_size)
+            {
+                _size = new_size;
+            }
+
             /**
              * @return the data array for specific data access.
-             * CAUTION: This is very permissive, ensure _data never
+             * CAUTION: This is very permissive, ensure the data array never
              * gets exposed directly to the public API.
              */
-            T* data(void) const
+            T* data(void)
             {
-                return _data;
+                return _storage.data();
+            }
+
+            /**
+             * @return the data array for specific read-only data access.
+             */
+            const T* data(void) const
+            {
+                return _storage.data();
             }
 
         private:
-            static constexpr IndexingPolicy _INDEXING_POLICY{ };
-            
-            T* _data{ };
-            size_t _capacity{ };
+            /**
+             * Completes a move from other once storage and size are transferred.
+             * Heap storage hands its array over, inline storage cannot: live
+             * elements are relocated into this LinearCollection's own array.
+             * @param other moved-from LinearCollection, left empty.
+             */
+            void take_elements(LinearCollection<T, IndexingPolicy, Duplication, Capacity>& other)
+            {
+                if (Policy::Storage::StoragePolicy<T, Capacity>::IS_INLINE)
+                {
+                    Utils::relocate_elements(data(), other.data(), _size);
+                }
+                other._size = 0;
+            }
+
+            /**
+             * Adds the provided item at the index determined by the IndexingPolicy,
+             * copying or moving it depending on its value category.
+             * @param item to add to this LinearCollection.
+             * @return true if push was successful, false otherwise.
+             */
+            template<typename U>
+            bool push_item(U&& item)
+            {
+                if (!is_valid() || is_full())
+                {
+                    return false;
+                }
+
+                size_t index{ };
+                bool can_add{ };
+
+                // Ordered and does not allow duplicate, avoid double search.
+                if (IndexingPolicy::IS_ORDERED 
+                        && Duplication == Policy::Duplication::DuplicationPolicy::FORBID_DUPLICATES)
+                {
+                    auto res = Indexing::indexing().find_insert_position(data(), _size, item);
+                    index = res.index;
+                    can_add = !res.found;
+                }
+
+                // Fallback for generic case.
+                else
+                {
+                    index = Indexing::indexing().get_push_index(data(), _size, item);
+                    can_add = Duplication == Policy::Duplication::DuplicationPolicy::ALLOW_DUPLICATES
+                           || Indexing::indexing().find_index(data(), _size, item) == _size;
+                }
+
+                if (!can_add)
+                {
+                    return false;
+                }
+
+                Indexing::indexing().insert(data(), _size, index, Utils::forward<U>(item));
+                _size++;
+                return true;
+            }
+
+            /**
+             * Pushes the provided item at the hinted index if it keeps the order,
+             * at the searched index otherwise, copying or moving it depending on
+             * its value category.
+             * @param hint expected insertion index.
+             * @param item to push.
+             * @return true if push was successful, false otherwise.
+             */
+            template<typename U>
+            bool push_item_hint(size_t hint, U&& item)
+            {
+                static_assert(IndexingPolicy::IS_ORDERED, "push_hint requires an ordered collection");
+                if (!is_valid() || is_full())
+                {
+                    return false;
+                }
+
+                auto res = Indexing::indexing().find_insert_position(data(), _size, item, hint);
+                if (res.found && Duplication == Policy::Duplication::DuplicationPolicy::FORBID_DUPLICATES)
+                {
+                    return false;
+                }
+
+                Indexing::indexing().insert(data(), _size, res.index, Utils::forward<U>(item));
+                _size++;
+                return true;
+            }
+
+            /**
+             * Inserts the provided item at the provided index, copying or moving
+             * it depending on its value category.
+             * @param item to insert.
+             * @param index of insertion. Must be within bounds.
+             * @return true if insertion successful, false otherwise.
+             */
+            template<typename U>
+            bool insert_item_at(U&& item, size_t index)
+            {
+                if (!is_valid() || is_full() || index > _size
+                        || (Duplication == Policy::Duplication::DuplicationPolicy::FORBID_DUPLICATES
+                    && Indexing::indexing().find_index(data(), _size, item) != _size))
+                {
+                    return false;
+                }
+
+                Indexing::indexing().insert(data(), _size, index, Utils::forward<U>(item));
+                _size++;
+                return true;
+            }
+
+            Policy::Storage::StoragePolicy<T, Capacity> _storage;
             size_t _size{ };
         };
     }
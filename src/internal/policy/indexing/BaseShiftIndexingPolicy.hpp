@@ -19,17 +19,24 @@
  *    All indexing policies must implement the following methods.
  *    
  *    size_t get_push_index(const T* data, size_t size, const T& item) const
- *    void insert(T* data, size_t size, size_t index, const T& item) const
+ *    void insert(T* data, size_t size, size_t index, Args&&... args) const
  *    size_t get_pop_index(const T* data, size_t size) const
  *    void remove(T* data, size_t size, size_t index) const
  *    size_t find_index(const T* data, size_t size, const T& item) const
  *    size_t remove_all(T* data, size_t size, const T& item) const
+ *    void clear(T* data, size_t size) const
  * 
  *    where T is the template type of items contained in the collection,
  *    data is the data array from the LinearCollection (visitor pattern),
  *    size is the current size of the LinearCollection and item is the
  *    item to insert, if policy allows, and index is the index where the
- *    insertion should occur.
+ *    insertion should occur. Slots past size are raw memory: insert
+ *    constructs the new element in place from args (an item to copy or
+ *    move, or constructor arguments) and remove / remove_all / clear
+ *    destroy the elements they take out.
+ *
+ *    Policies keeping an index of their own declare IS_STATEFUL as true,
+ *    see IndexingState.hpp.
  *    
  *    To avoid warnings, comment out the name (not the type) of all unused
  *    parameters.
@@ -40,6 +47,7 @@
  */
 #pragma once
 #include <stddef.h>
+#include "../../utils/Memory.hpp"
 
 namespace DuinoCollections
 {
@@ -68,37 +76,60 @@ namespace DuinoCollections
                 template<typename T>
                 struct BaseShiftIndexingPolicy
                 {
+                    static const bool IS_STATEFUL{ false };
+
                     /**
-                     * Inserts the provided item at the specified index and
+                     * Constructs an item at the specified index and
                      * rearranges the data array accordingly through a
-                     * rigth shift.
+                     * rigth shift (single memmove for trivially copyable types).
                      * @param data array from the owning collection.
                      * @param size of the owning collection.
                      * @param target_index where the insertion should occur.
-                     * @param item to insert.
+                     * @param args arguments forwarded to the constructor of T,
+                     *        usually the item to copy or move.
                      */
-                    void insert(T* data, size_t size, size_t target_index, const T& item) const
+                    template<typename... Args>
+                    void insert(T* data, size_t size, size_t target_index, Args&&... args) const
                     {
-                        for (size_t current_index = size; current_index > target_index; --current_index)
-                        {
-                            data[current_index] = data[current_index - 1];
-                        }
-                        data[target_index] = item;
+                        Utils::relocate_elements(data + target_index + 1, data + target_index, size - target_index);
+                        Utils::construct_at(data + target_index, Utils::forward<Args>(args)...);
                     }
 
                     /**
-                     * Removes the item at the specidied index by performing a
-                     * left shift in the data array.
+                     * Destroys the item at the specidied index and performs a
+                     * left shift in the data array (single memmove for trivially
+                     * copyable types).
                      * @param data array from the owning collection.
                      * @param size of the owning collection.
                      * @param target_index where deletion should occur.
                      */
                     void remove(T* data, size_t size, size_t target_index) const
                     {
-                        for (size_t current_index = target_index; current_index < size - 1; ++current_index)
+                        Utils::destroy_at(data + target_index);
+                        Utils::relocate_elements(data + target_index, data + target_index + 1, size - target_index - 1);
+                    }
+
+                    /**
+                     * Destroys the items of [first, last) and closes the gap with
+                     * a single left shift of the tail (single memmove for
+                     * trivially copyable types).
+                     * @param data array from the owning collection.
+                     * @param size of the owning collection.
+                     * @param first index of the first item to remove.
+                     * @param last index past the last item to remove.
+                     * @return the number of items removed.
+                     */
+                    size_t remove_range(T* data, size_t size, size_t first, size_t last) const
+                    {
+                        // Relocating the tail onto itself would corrupt it.
+                        if (first == last)
                         {
-                            data[current_index] = data[current_index + 1];
+                            return 0;
                         }
+
+                        Utils::destroy_elements(data + first, last - first);
+                        Utils::relocate_elements(data + first, data + last, size - last);
+                        return last - first;
                     }
 
                     /**
@@ -112,6 +143,16 @@ namespace DuinoCollections
                         return size - 1;
                     }
 
+                    /**
+                     * Destroys every item of the owning collection.
+                     * @param data array from the owning collection.
+                     * @param size of the owning collection.
+                     */
+                    void clear(T* data, size_t size) const
+                    {
+                        Utils::destroy_elements(data, size);
+                    }
+
                 protected:
                     /**
                      * Initializes this BaseShiftIndexingPolicy. The visibility
@@ -0,0 +1,417 @@
+/*
+ ******************************************************************************
+ *  HashIndexingPolicy.hpp
+ *
+ *  Indexing policy for unordered, hash-indexed collections.
+ *
+ *  Author: Pierre DEBAS
+ *  Copyright (c) 2026
+ *
+ *  MIT License
+ *  https://github.com/Pierrolefou881/DuinoCollections
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Description:
+ *    This type is internal and should not be used outside the
+ *    library DuinoCollections.
+ *
+ *    All indexing policies must implement the following methods.
+ *
+ *    size_t get_push_index(const T* data, size_t size, const T& item) const
+ *    void insert(T* data, size_t size, size_t index, Args&&... args) const
+ *    size_t get_pop_index(const T* data, size_t size) const
+ *    void remove(T* data, size_t size, size_t index) const
+ *    size_t find_index(const T* data, size_t size, const T& item) const
+ *    size_t remove_all(T* data, size_t size, const T& item) const
+ *    void clear(T* data, size_t size) const
+ *    SearchResult find_insert_position(const T* data, size_t size, const T& item) const
+ *
+ *    where T is the template type of items contained in the collection,
+ *    data is the data array from the LinearCollection (visitor pattern),
+ *    size is the current size of the LinearCollection and item is the
+ *    item to insert, if policy allows, and index is the index where the
+ *    insertion should occur. Slots past size are raw memory: insert
+ *    constructs the new element in place from args (an item to copy or
+ *    move, or constructor arguments) and remove / remove_all / clear
+ *    destroy the elements they take out.
+ *
+ *    HashIndexingPolicy is stateful (see IndexingState.hpp): insert,
+ *    remove, remove_all and clear update its index and are not const.
+ *
+ *    CAUTION: this file is an internal header and not part of the public API.
+ *
+ ******************************************************************************
+ */
+#pragma once
+#include <stddef.h>
+#include <string.h>
+#include "BaseShiftIndexingPolicy.hpp"
+#include "../storage/StoragePolicy.hpp"
+#include "../../utils/Memory.hpp"
+#include "../../utils/HashTable.hpp"
+
+namespace DuinoCollections
+{
+    namespace Internal
+    {
+        namespace Policy
+        {
+            namespace Indexing
+            {
+                /**
+                 * Defines unordered indexing through an open-addressing hash table.
+                 * Elements stay contiguous in the data array of the owning
+                 * collection, the table maps each of them to its index.
+                 *
+                 * The table uses linear probing and a power-of-two size holding
+                 * at least 1.5 times the capacity, so lookups are O(1) expected.
+                 * Deletion shifts the following entries of the probe sequence
+                 * back instead of leaving tombstones: lookups never degrade as
+                 * items come and go. To stay O(1), removal moves the last
+                 * element into the freed index, hence element order is not
+                 * preserved.
+                 *
+                 * Index memory: (table size + capacity) entries, i.e. 2.5 to
+                 * 4 entries per element of capacity since the table is rounded
+                 * up to a power of two. Inline if Capacity is not 0, allocated
+                 * once at construction otherwise.
+                 * Inline entries use the smallest unsigned type holding a
+                 * bucket number (uint8_t up to 168 elements, uint16_t up to
+                 * 43253), heap entries are size_t.
+                 * @param T type contained in the owning collection. Must
+                 *          implement equality operators == and !=.
+                 * @param Hash functor returning a size_t hash for a const T&.
+                 *          Equal items must have equal hashes.
+                 * @param Capacity capacity of the owning collection if known
+                 *          at compile time, 0 otherwise.
+                 */
+                template<typename T, typename Hash, size_t Capacity = 0>
+                class HashIndexingPolicy
+                {
+                public:
+                    static const bool IS_ORDERED{ false };
+                    static const bool IS_STATEFUL{ true };
+
+                    /**
+                     * Initializes this HashIndexingPolicy with an empty index for
+                     * the provided capacity.
+                     * @param capacity of the owning collection. Ignored if Capacity
+                     *        is not 0.
+                     */
+                    explicit HashIndexingPolicy(size_t capacity)
+                        : _index{ Capacity > 0 ? 0 : index_capacity_for(capacity) }
+                        , _table_mask{ Utils::hash_table_capacity(Capacity > 0 ? Capacity : capacity, MAX_LOAD_PERCENT) - 1 }
+                    {
+                        reset();
+                    }
+
+                    HashIndexingPolicy(const HashIndexingPolicy&) = delete;
+                    HashIndexingPolicy& operator =(const HashIndexingPolicy&) = delete;
+
+                    HashIndexingPolicy(HashIndexingPolicy&& other) noexcept
+                        : _index{ Utils::move(other._index) }
+                        , _table_mask{ other._table_mask }
+                    {
+                        take_index(other);
+                    }
+
+                    HashIndexingPolicy& operator =(HashIndexingPolicy&& other) noexcept
+                    {
+                        if (this != &other)
+                        {
+                            _index = Utils::move(other._index);
+                            _table_mask = other._table_mask;
+                            take_index(other);
+                        }
+                        return *this;
+                    }
+
+                    /**
+                     * @return true if the index is usable, false otherwise.
+                     *         Always true if the index is inline.
+                     */
+                    bool is_valid(void) const
+                    {
+                        return _index.is_valid();
+                    }
+
+                    /**
+                     * Determines the index where a push should occur. Hashed
+                     * collections always append.
+                     * @param data unused.
+                     * @param size of the owning collection. Corresponds to the push-in index.
+                     * @param item unused.
+                     * @return size.
+                     */
+                    size_t get_push_index(const T* /*data*/, size_t size, const T& /*item*/) const
+                    {
+                        return size;
+                    }
+
+                    /**
+                     * Determines where popping out should occur. Always the last
+                     * element, which requires no relocation.
+                     * @param data unused.
+                     * @param size of the owning collection.
+                     */
+                    size_t get_pop_index(const T* /*data*/, size_t size) const
+                    {
+                        return size - 1;
+                    }
+
+                    /**
+                     * Finds the index of a provided item, if present.
+                     * Complexity: O(1) expected.
+                     * @param data array of the owning collection.
+                     * @param size of the owning collection.
+                     * @param item to find the index of.
+                     * @return index of item, if present; size of collection otherwise.
+                     */
+                    size_t find_index(const T* data, size_t size, const T& item) const
+                    {
+                        const Entry* table = _index.data();
+                        for (size_t bucket = home_bucket(item); table[bucket] != EMPTY;
+                                bucket = (bucket + 1) & _table_mask)
+                        {
+                            if (data[table[bucket] - 1] == item)
+                            {
+                                return table[bucket] - 1;
+                            }
+                        }
+
+                        return size; // not found
+                    }
+
+                    /**
+                     * Constructs an item at the specified index and indexes it.
+                     * Complexity: O(1) expected. If index is not size, the element
+                     * previously there is moved to the end of the data array.
+                     * @param data array from the owning collection.
+                     * @param size of the owning collection.
+                     * @param target_index where the insertion should occur.
+                     * @param args arguments forwarded to the constructor of T,
+                     *        usually the item to copy or move.
+                     */
+                    template<typename... Args>
+                    void insert(T* data, size_t size, size_t target_index, Args&&... args)
+                    {
+                        if (target_index < size)
+                        {
+                            move_element(data, target_index, size);
+                        }
+
+                        Utils::construct_at(data + target_index, Utils::forward<Args>(args)...);
+
+                        size_t bucket = home_bucket(data[target_index]);
+                        while (table()[bucket] != EMPTY)
+                        {
+                            bucket = (bucket + 1) & _table_mask;
+                        }
+                        link(bucket, target_index);
+                    }
+
+                    /**
+                     * Destroys the item at the specified index and unindexes it.
+                     * Complexity: O(1) expected. The last element is moved into
+                     * the freed index. The item itself is not read, it may have
+                     * been moved out already.
+                     * @param data array from the owning collection.
+                     * @param size of the owning collection.
+                     * @param target_index where deletion should occur.
+                     */
+                    void remove(T* data, size_t size, size_t target_index)
+                    {
+                        unlink(data, positions()[target_index]);
+                        Utils::destroy_at(data + target_index);
+                        if (target_index != size - 1)
+                        {
+                            move_element(data, size - 1, target_index);
+                        }
+                    }
+
+                    /**
+                     * Removes all occurrences of the provided item from the owning collection.
+                     * @param data array of the owning collection.
+                     * @param size of the owning collection.
+                     * @param item to remove entirely from the owning collection.
+                     * @return the number of occurrences deleted.
+                     */
+                    size_t remove_all(T* data, size_t size, const T& item)
+                    {
+                        size_t count = 0;
+                        size_t index = find_index(data, size, item);
+                        while (index != size - count)
+                        {
+                            remove(data, size - count, index);
+                            ++count;
+                            index = find_index(data, size - count, item);
+                        }
+
+                        return count;
+                    }
+
+                    /**
+                     * Destroys every item of the owning collection and empties the index.
+                     * @param data array from the owning collection.
+                     * @param size of the owning collection.
+                     */
+                    void clear(T* data, size_t size)
+                    {
+                        Utils::destroy_elements(data, size);
+                        reset();
+                    }
+
+                    /**
+                     * Determines whether an item is already present. Insertion
+                     * always occurs at the end.
+                     * @param data array of the owning collection.
+                     * @param size of the owning collection.
+                     * @param item to insert.
+                     * @return { size, presence of item }
+                     */
+                    SearchResult find_insert_position(const T* data, size_t size, const T& item) const
+                    {
+                        return { size, find_index(data, size, item) != size };
+                    }
+
+                    // Forbid dynamic allocation
+                    void* operator new(size_t) = delete;
+                    void* operator new[](size_t) = delete;
+                    void operator delete(void*) = delete;
+                    void operator delete[](void*) = delete;
+
+                private:
+                    // Keeps at least 1.5 buckets per element.
+                    static const size_t MAX_LOAD_PERCENT{ 66 };
+                    // Table entries hold element index + 1, 0 marks a free bucket.
+                    static const size_t EMPTY{ 0 };
+                    static constexpr size_t TABLE_CAPACITY{ Capacity > 0 ? Utils::hash_table_capacity(Capacity, MAX_LOAD_PERCENT) : 0 };
+                    static constexpr size_t INDEX_CAPACITY{ Capacity > 0 ? TABLE_CAPACITY + Capacity : 0 };
+
+                    // Holds element indices + 1 (at most Capacity) and bucket
+                    // numbers (less than TABLE_CAPACITY).
+                    using Entry = typename Utils::Conditional<(Capacity > 0),
+                        typename Utils::SmallestUnsigned<TABLE_CAPACITY - 1>::type, size_t>::type;
+
+                    static_assert(Capacity == 0 || TABLE_CAPACITY > 0, "Capacity too large for a hash table");
+
+                    /**
+                     * @return the number of heap entries for capacity elements,
+                     *         0 (failed allocation) if the table cannot be sized.
+                     */
+                    static size_t index_capacity_for(size_t capacity)
+                    {
+                        size_t table_capacity = Utils::hash_table_capacity(capacity, MAX_LOAD_PERCENT);
+                        return table_capacity > 0 ? table_capacity + capacity : 0;
+                    }
+
+                    /**
+                     * @return the first bucket of the probe sequence of item.
+                     */
+                    size_t home_bucket(const T& item) const
+                    {
+                        return Hash{ }(item) & _table_mask;
+                    }
+
+                    /**
+                     * @return the hash table, (_table_mask + 1) buckets.
+                     */
+                    Entry* table(void)
+                    {
+                        return _index.data();
+                    }
+
+                    /**
+                     * @return the bucket of each element, by element index.
+                     */
+                    Entry* positions(void)
+                    {
+                        return _index.data() + _table_mask + 1;
+                    }
+
+                    /**
+                     * Points bucket to the element at index.
+                     */
+                    void link(size_t bucket, size_t index)
+                    {
+                        table()[bucket] = static_cast<Entry>(index + 1);
+                        positions()[index] = static_cast<Entry>(bucket);
+                    }
+
+                    /**
+                     * Relocates a live element to a raw slot and updates its bucket.
+                     * @param data array from the owning collection.
+                     * @param from index of the element to move.
+                     * @param to raw slot receiving the element.
+                     */
+                    void move_element(T* data, size_t from, size_t to)
+                    {
+                        Utils::relocate_elements(data + to, data + from, 1);
+                        link(positions()[from], to);
+                    }
+
+                    /**
+                     * Frees bucket, then shifts back the entries following it
+                     * in the probe sequence (no tombstone). Only the entries
+                     * moved are rehashed.
+                     * @param data array from the owning collection.
+                     * @param bucket to free.
+                     */
+                    void unlink(const T* data, size_t bucket)
+                    {
+                        Entry* buckets = table();
+                        size_t next = bucket;
+                        while (true)
+                        {
+                            next = (next + 1) & _table_mask;
+                            if (buckets[next] == EMPTY)
+                            {
+                                break;
+                            }
+
+                            // The entry can fill the hole unless its home bucket
+                            // lies cyclically in (bucket, next].
+                            size_t home = home_bucket(data[buckets[next] - 1]);
+                            if (((next - home) & _table_mask) >= ((next - bucket) & _table_mask))
+                            {
+                                link(bucket, buckets[next] - 1);
+                                bucket = next;
+                            }
+                        }
+
+                        buckets[bucket] = EMPTY;
+                    }
+
+                    /**
+                     * Empties the hash table.
+                     */
+                    void reset(void)
+                    {
+                        if (is_valid())
+                        {
+                            memset(table(), 0, (_table_mask + 1) * sizeof(Entry));
+                        }
+                    }
+
+                    /**
+                     * Completes a move from other once the index is transferred.
+                     * A heap index is handed over, an inline one is copied.
+                     * @param other moved-from HashIndexingPolicy, left empty.
+                     */
+                    void take_index(HashIndexingPolicy& other)
+                    {
+                        if (Storage::StoragePolicy<Entry, INDEX_CAPACITY>::IS_INLINE)
+                        {
+                            Utils::copy_elements(_index.data(), other._index.data(), _index.capacity());
+                            other.reset();
+                        }
+                    }
+
+                    Storage::StoragePolicy<Entry, INDEX_CAPACITY> _index;
+                    size_t _table_mask{ };
+                };
+            }
+        }
+    }
+}
@@ -0,0 +1,105 @@
+/*
+ ******************************************************************************
+ *  IndexingState.hpp
+ *
+ *  Holds the indexing policy instance of a LinearCollection.
+ *
+ *  Author: Pierre DEBAS
+ *  Copyright (c) 2026
+ *
+ *  MIT License
+ *  https://github.com/Pierrolefou881/DuinoCollections
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Description:
+ *    This type is internal and should not be used outside the
+ *    library DuinoCollections.
+ *
+ *    Most indexing policies are stateless and only work on the data array
+ *    they are given. Some (e.g. HashIndexingPolicy) maintain their own index
+ *    and declare IS_STATEFUL as true; they must then implement:
+ *
+ *    explicit IndexingPolicy(size_t capacity)
+ *    bool is_valid(void) const
+ *
+ *    and be movable. LinearCollection privately inherits IndexingState so
+ *    that stateless policies take no room in the collection.
+ *
+ *    CAUTION: this file is an internal header and not part of the public API.
+ *
+ ******************************************************************************
+ */
+#pragma once
+#include <stddef.h>
+
+namespace DuinoCollections
+{
+    namespace Internal
+    {
+        namespace Policy
+        {
+            namespace Indexing
+            {
+                /**
+                 * Stateless indexing: a policy instance is built on demand,
+                 * nothing is stored.
+                 * @param IndexingPolicy policy of the owning collection.
+                 * @param IsStateful IndexingPolicy::IS_STATEFUL.
+                 */
+                template<typename IndexingPolicy, bool IsStateful = IndexingPolicy::IS_STATEFUL>
+                class IndexingState
+                {
+                protected:
+                    explicit IndexingState(size_t /*capacity*/)
+                    {
+                        // Empty body.
+                    }
+
+                    static IndexingPolicy indexing(void)
+                    {
+                        return IndexingPolicy();
+                    }
+
+                    static constexpr bool is_indexing_valid(void)
+                    {
+                        return true;
+                    }
+                };
+
+                /**
+                 * Stateful indexing: the policy instance is stored and sized
+                 * after the capacity of the owning collection.
+                 * @param IndexingPolicy policy of the owning collection.
+                 */
+                template<typename IndexingPolicy>
+                class IndexingState<IndexingPolicy, true>
+                {
+                protected:
+                    explicit IndexingState(size_t capacity) : _indexing{ capacity }
+                    {
+                        // Empty body.
+                    }
+
+                    IndexingPolicy& indexing(void)
+                    {
+                        return _indexing;
+                    }
+
+                    const IndexingPolicy& indexing(void) const
+                    {
+                        return _indexing;
+                    }
+
+                    bool is_indexing_valid(void) const
+                    {
+                        return _indexing.is_valid();
+                    }
+
+                private:
+                    IndexingPolicy _indexing;
+                };
+            }
+        }
+    }
+}
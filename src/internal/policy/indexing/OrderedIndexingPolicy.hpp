@@ -19,18 +19,25 @@
  *    All indexing policies must implement the following methods.
  *    
  *    size_t get_push_index(const T* data, size_t size, const T& item) const
- *    void insert(T* data, size_t size, size_t index, const T& item) const
+ *    void insert(T* data, size_t size, size_t index, Args&&... args) const
  *    size_t get_pop_index(const T* data, size_t size) const
  *    void remove(T* data, size_t size, size_t index) const
  *    size_t find_index(const T* data, size_t size, const T& item) const
  *    size_t remove_all(T* data, size_t size, const T& item) const
+ *    void clear(T* data, size_t size) const
  *    SearchResult find_insert_position(const T* data, size_t size, const T& item) const
  * 
  *    where T is the template type of items contained in the collection,
  *    data is the data array from the LinearCollection (visitor pattern),
  *    size is the current size of the LinearCollection and item is the
  *    item to insert, if policy allows, and index is the index where the
- *    insertion should occur.
+ *    insertion should occur. Slots past size are raw memory: insert
+ *    constructs the new element in place from args (an item to copy or
+ *    move, or constructor arguments) and remove / remove_all / clear
+ *    destroy the elements they take out.
+ *
+ *    Policies keeping an index of their own declare IS_STATEFUL as true,
+ *    see IndexingState.hpp.
  *    
  *    To avoid warnings, comment out the name (not the type) of all unused
  *    parameters.
@@ -40,7 +47,10 @@
  ******************************************************************************
  */
 #pragma once
+#include <stdint.h>
 #include "BaseShiftIndexingPolicy.hpp"
+#include "../../../SearchStrategy.hpp"
+#include "../../utils/Sort.hpp"
 
 namespace DuinoCollections
 {
@@ -50,6 +60,24 @@ namespace DuinoCollections
         {
             namespace Indexing
             {
+                /**
+                 * Turns a sorting order into the predicate of an upper bound:
+                 * lower_bound kernels then stop at the first element coming
+                 * after key instead of the first one not coming before it.
+                 * @param SortOrder sorting order of the searched array.
+                 */
+                template<typename SortOrder>
+                struct UpperBoundOrder
+                {
+                    SortOrder order;
+
+                    template<typename T, typename Key>
+                    bool operator()(const T& element, const Key& key) const
+                    {
+                        return !order(key, element);
+                    }
+                };
+
                 /**
                  * Defines sequential, unordered indexing policy.
                  * @param T type contained in the owning collection. Must
@@ -57,130 +85,221 @@ namespace DuinoCollections
                  *          comparison operators <, <=, > and >=.
                  *          (at least < and > required).
                  * @param Compare ssor
+                 * @param Search lower bound kernel, see SearchStrategy.hpp.
+                 *          Defaulted to BinarySearch.
                  */
-                template<typename T, typename SortOrder>
+                template<typename T, typename SortOrder, typename Search = BinarySearch>
                 struct OrderedIndexingPolicy : public BaseShiftIndexingPolicy<T>
                 {
                     static const bool IS_ORDERED{ true };
 
+                    // Galloping steps from the end before a full search,
+                    // i.e. items landing among the last 15 are found faster.
+                    static const uint8_t GALLOP_STEPS{ 4 };
+
                     SortOrder order{};
+                    Search search{};
 
                     /**
                      * Returns the index where the item should be inserted in order to keep
                      * the collection sorted (ascending order).
                      *
-                     * Uses binary search (lower_bound).
-                     * Complexity: O(log n)
+                     * Monotonic insertions (e.g. timestamps) are the common case:
+                     * an item coming after the last element is appended after a
+                     * single comparison. Otherwise the search gallops from the end
+                     * (1, 2, 4... elements back) for nearly sorted input, then
+                     * falls back to the lower_bound of Search.
+                     * Complexity: O(1) when appending, O(log n) otherwise.
                      * 
                      * @param data array of the owning collection.
                      * @param size of the owning collection.
-                     * @param item to push in.
+                     * @param item to push in, or lookup key comparable with T
+                     *        through SortOrder (transparent lookup).
                      * @return the item where insertion should occur.
                      */
-                    size_t get_push_index(const T* data, size_t size, const T& item) const
+                    template<typename Key>
+                    size_t get_push_index(const T* data, size_t size, const Key& item) const
                     {
-                        size_t left = 0;
-                        size_t right = size;
+                        if (size == 0 || order(data[size - 1], item))
+                        {
+                            return size;
+                        }
 
-                        while (left < right)
+                        // data[right] does not come before item.
+                        size_t right = size - 1;
+                        size_t step = 1;
+                        for (uint8_t i = 0; i < GALLOP_STEPS && step <= right; i++, step <<= 1)
                         {
-                            size_t middle = left + ((right - left) >> 1);
-                            if (order(data[middle], item))
-                            {
-                                left = middle + 1;
-                            }
-                            else
+                            if (order(data[right - step], item))
                             {
-                                right = middle;
+                                auto left = right - step + 1;
+                                return left + search.lower_bound(data + left, right - left, item, order);
                             }
+                            right -= step;
                         }
 
-                        // first index where 
-                        //    data[index] >= item (ascending order) 
-                        // or data[index] <= item (descending order)
-                        return left;
+                        return search.lower_bound(data, right, item, order);
+                    }
+
+                    /**
+                     * Returns the index where the item should be inserted, trusting
+                     * the provided hint if it is correct: no search occurs then.
+                     * Falls back to get_push_index otherwise.
+                     * Complexity: O(1) with a correct hint, O(log n) otherwise.
+                     *
+                     * @param data array of the owning collection.
+                     * @param size of the owning collection.
+                     * @param item to push in, or lookup key comparable with T.
+                     * @param hint expected insertion index.
+                     * @return the item where insertion should occur.
+                     */
+                    template<typename Key>
+                    size_t get_push_index(const T* data, size_t size, const Key& item, size_t hint) const
+                    {
+                        bool is_hint_valid = hint <= size
+                            && (hint == 0 || order(data[hint - 1], item))
+                            && (hint == size || !order(data[hint], item));
+                        return is_hint_valid ? hint : get_push_index(data, size, item);
                     }
 
                     /**
                      * Finds the index of the first occurrence of the provided item,
                      * if any.
                      *
-                     * Uses binary search (lower_bound).
+                     * Uses the lower_bound of Search.
                      * Complexity: O(log n)
                      * 
                      * @param data array of the owning collection.
                      * @param size of the owning collection.
-                     * @param item to find.
+                     * @param item to find, or lookup key comparable with T
+                     *        through SortOrder and ==.
                      * @return index of the found item, size otherwise.
                      */
-                    size_t find_index(const T* data, size_t size, const T& item) const
+                    template<typename Key>
+                    size_t find_index(const T* data, size_t size, const Key& item) const
                     {
-                        auto index = get_push_index(data, size, item);
+                        // first index where 
+                        //    data[index] >= item (ascending order) 
+                        // or data[index] <= item (descending order)
+                        auto index = search.lower_bound(data, size, item, order);
                         return (index < size && data[index] == item) ? index : size;
                     }
 
                     /**
-                     * Determines the number of occurrences of the provided item, if
-                     * any.
-                     * 
-                     * Uses binary search (lower_bound).
+                     * Specific to ordered policies, used by range queries.
                      * Complexity: O(log n)
+                     *
+                     * @param data array of the owning collection.
+                     * @param size of the owning collection.
+                     * @param item lookup key comparable with T through SortOrder.
+                     * @return the first index where data[index] does not come
+                     *         before item, size if none.
+                     */
+                    template<typename Key>
+                    size_t lower_bound(const T* data, size_t size, const Key& item) const
+                    {
+                        return search.lower_bound(data, size, item, order);
+                    }
+
+                    /**
+                     * Specific to ordered policies, used by range queries.
+                     * Complexity: O(log n)
+                     *
+                     * @param data array of the owning collection.
+                     * @param size of the owning collection.
+                     * @param item lookup key comparable with T through SortOrder.
+                     * @return the first index where data[index] comes after item,
+                     *         size if none.
+                     */
+                    template<typename Key>
+                    size_t upper_bound(const T* data, size_t size, const Key& item) const
+                    {
+                        return search.lower_bound(data, size, item, UpperBoundOrder<SortOrder>{ order });
+                    }
+
+                    /**
+                     * Removes every occurrence of the provided item. Occurrences
+                     * are contiguous: they are located by two searches, then
+                     * the tail is moved over them at once, see remove_range.
+                     * Complexity: O(log n) searches, O(n) moves.
                      * 
                      * @param data array of the owning collection.
                      * @param size of the owning collection.
                      * @param item to remove entirely from the owning collection.
-                     * @param firt occurrence of item (out parameter).
-                     * @param last occurrence of item (out parameter).
+                     * @return the number of items removed.
                      */
                     size_t remove_all(T* data, size_t size, const T& item) const
                     {
-                        // lower bound
-                        auto lower_bound = find_index(data, size, item);
-                        if (lower_bound == size || item != data[lower_bound])
-                        {
-                            return 0;
-                        }
-
-                        // upper_bound
-                        auto left = lower_bound;
-                        auto right = size;
-
-                        while (left < right)
-                        {
-                            size_t middle = left + ((right - left) >> 1);
-                            if (!order(item, data[middle]))
-                            {
-                                left = middle + 1;
-                            }
-                            else
-                            {
-                                right = middle;
-                            }
-                        }
-
-                        auto count = left - lower_bound;
-                        for (auto current_index = left; current_index < size; current_index++)
-                        {
-                            data[current_index - count = data[current_index]];
-                        }
+                        auto first = lower_bound(data, size, item);
+                        auto last = first + upper_bound(data + first, size - first, item);
+                        return this->remove_range(data, size, first, last);
+                    }
 
-                        return count;
+                    /**
+                     * Removes every item from lo (included) to hi (excluded) in
+                     * sorting order, see remove_all. Specific to ordered policies.
+                     * Complexity: O(log n) searches, O(n) moves.
+                     *
+                     * @param data array of the owning collection.
+                     * @param size of the owning collection.
+                     * @param lo first key of the range, comparable with T.
+                     * @param hi key past the range, comparable with T.
+                     * @return the number of items removed.
+                     */
+                    template<typename Key>
+                    size_t remove_between(T* data, size_t size, const Key& lo, const Key& hi) const
+                    {
+                        auto first = lower_bound(data, size, lo);
+                        auto last = first + lower_bound(data + first, size - first, hi);
+                        return this->remove_range(data, size, first, last);
                     }
 
                     /** 
                      * Determines whether an item can be inserted and where insertion should occur.
                      * @param data array of the owning collection.
                      * @param size of the owning collection.
-                     * @param item to insert.
+                     * @param item to insert, or lookup key comparable with T
+                     *        through SortOrder and ==.
                      * @return possibility to add and insertion index.
                      */
-                    SearchResult find_insert_position(const T* data, size_t size, const T& item) const
+                    template<typename Key>
+                    SearchResult find_insert_position(const T* data, size_t size, const Key& item) const
                     {
                         auto index = get_push_index(data, size, item);
-                        bool found = index != size && item == data[index];
+                        bool found = index != size && data[index] == item;
                         return { index, found };
                     }
 
+                    /**
+                     * Same as find_insert_position, trusting the provided hint if
+                     * it is correct, see get_push_index(data, size, item, hint).
+                     * @param data array of the owning collection.
+                     * @param size of the owning collection.
+                     * @param item to insert, or lookup key comparable with T.
+                     * @param hint expected insertion index.
+                     * @return possibility to add and insertion index.
+                     */
+                    template<typename Key>
+                    SearchResult find_insert_position(const T* data, size_t size, const Key& item, size_t hint) const
+                    {
+                        auto index = get_push_index(data, size, item, hint);
+                        bool found = index != size && data[index] == item;
+                        return { index, found };
+                    }
+
+                    /**
+                     * Sorts the whole data array, in place. Specific to ordered
+                     * policies, used by bulk insertions.
+                     * Complexity: O(n log n)
+                     *
+                     * @param data array of the owning collection.
+                     * @param size of the owning collection.
+                     */
+                    void sort(T* data, size_t size) const
+                    {
+                        Utils::heap_sort(data, size, order);
+                    }
+
                     // Forbid dynamic allocation
                     void* operator new(size_t) = delete;
                     void* operator new[](size_t) = delete;
@@ -19,18 +19,25 @@
  *    All indexing policies must implement the following methods.
  *    
  *    size_t get_push_index(const T* data, size_t size, const T& item) const
- *    void insert(T* data, size_t size, size_t index, const T& item) const
+ *    void insert(T* data, size_t size, size_t index, Args&&... args) const
  *    size_t get_pop_index(const T* data, size_t size) const
  *    void remove(T* data, size_t size, size_t index) const
  *    size_t find_index(const T* data, size_t size, const T& item) const
  *    size_t remove_all(T* data, size_t size, const T& item) const
+ *    void clear(T* data, size_t size) const
  *    SearchResult find_insert_position(const T* data, size_t size, const T& item) const
  * 
  *    where T is the template type of items contained in the collection,
  *    data is the data array from the LinearCollection (visitor pattern),
  *    size is the current size of the LinearCollection and item is the
  *    item to insert, if policy allows, and index is the index where the
- *    insertion should occur.
+ *    insertion should occur. Slots past size are raw memory: insert
+ *    constructs the new element in place from args (an item to copy or
+ *    move, or constructor arguments) and remove / remove_all / clear
+ *    destroy the elements they take out.
+ *
+ *    Policies keeping an index of their own declare IS_STATEFUL as true,
+ *    see IndexingState.hpp.
  *    
  *    To avoid warnings, comment out the name (not the type) of all unused
  *    parameters.
@@ -41,6 +48,7 @@
  */
 #pragma once
 #include "BaseShiftIndexingPolicy.hpp"
+#include "../../utils/VectorScan.hpp"
 
 namespace DuinoCollections
 {
@@ -76,6 +84,8 @@ namespace DuinoCollections
 
                     /**
                      * Finds the index of a provided item, if present.
+                     * Arithmetic types are compared a vector at a time on
+                     * SSE2 / AVX2 targets, see VectorScan.hpp.
                      * @param data array of the owning collection.
                      * @param size of the owning collection.
                      * @param item to find the index of.
@@ -84,19 +94,14 @@ namespace DuinoCollections
                      */
                     size_t find_index(const T* data, size_t size, const T& item) const
                     {
-                        for (size_t i = 0; i < size; ++i)
-                        {
-                            if (data[i] == item)
-                            {
-                                return i;
-                            }
-                        }
-
-                        return size; // not found
+                        return Utils::find_equal(data, size, item);
                     }
 
                     /**
                      * Removes all occurrences of the provided item from the owning collection.
+                     * Occurrences are located with find_index and the kept runs between
+                     * them are relocated as blocks (single memmove for trivially
+                     * copyable types).
                      * @param data array of the owning collection.
                      * @param size of the owning collection.
                      * @param item to remove entirely from the owning collection.
@@ -104,15 +109,20 @@ namespace DuinoCollections
                      */
                     size_t remove_all(T* data, size_t size, const T& item) const
                     {
+                        auto write = find_index(data, size, item);
+                        auto read = write;
 
-                        size_t write = 0;
-
-                        for (size_t read = 0; read < size; ++read)
+                        // Slots in [write, read) are raw: removed occurrences are
+                        // destroyed and kept runs are relocated over them.
+                        while (read < size)
                         {
-                            if (!(data[read] == item))
-                            {
-                                data[write++] = data[read];
-                            }
+                            Utils::destroy_at(data + read);
+                            read++;
+
+                            auto run = find_index(data + read, size - read, item);
+                            Utils::relocate_elements(data + write, data + read, run);
+                            write += run;
+                            read += run;
                         }
 
                         return size - write;    // Number of occurrences removed.
@@ -0,0 +1,204 @@
+/*
+ ******************************************************************************
+ *  StoragePolicy.hpp
+ *
+ *  Element storage for fixed-capacity collections.
+ *
+ *  Author: Pierre DEBAS
+ *  Copyright (c) 2026
+ *
+ *  MIT License
+ *  https://github.com/Pierrolefou881/DuinoCollections
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Description:
+ *    This type is internal and should not be used outside the
+ *    library DuinoCollections.
+ *
+ *    All storage policies must implement the following members.
+ *
+ *    static constexpr bool IS_INLINE
+ *    explicit StoragePolicy(size_t capacity)
+ *    T* data(void)
+ *    const T* data(void) const
+ *    size_t capacity(void) const
+ *    bool is_valid(void) const
+ *
+ *    where T is the template type of items contained in the collection
+ *    and capacity is the maximum number of items requested by the owning
+ *    collection.
+ *
+ *    Storage is raw, uninitialized memory: no element is constructed nor
+ *    destroyed by the policy. The owning collection constructs elements in
+ *    place and destroys them, since it is the only one to know which slots
+ *    hold a live element. For the same reason, moving an inline storage
+ *    transfers no element, the owning collection relocates them.
+ *
+ *    CAUTION: this file is an internal header and not part of the public API.
+ *
+ ******************************************************************************
+ */
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace DuinoCollections
+{
+    namespace Internal
+    {
+        namespace Policy
+        {
+            namespace Storage
+            {
+                /**
+                 * Inline storage: the array is a member of the owning collection,
+                 * so no heap allocation occurs and global collections are laid
+                 * out in .bss by the linker. Capacity is a compile-time constant,
+                 * which lets the compiler fold index arithmetic and remove
+                 * validity checks.
+                 * @param T type contained in the owning collection.
+                 * @param Capacity maximum number of elements. Strictly positive.
+                 */
+                template<typename T, size_t Capacity>
+                class StoragePolicy
+                {
+                public:
+                    static constexpr bool IS_INLINE{ true };
+
+                    /**
+                     * Initializes this StoragePolicy. Capacity is fixed at compile
+                     * time, the requested one is ignored.
+                     */
+                    explicit StoragePolicy(size_t /*capacity*/)
+                    {
+                        // Empty body.
+                    }
+
+                    StoragePolicy(const StoragePolicy&) = delete;
+                    StoragePolicy& operator=(const StoragePolicy&) = delete;
+
+                    StoragePolicy(StoragePolicy&&) noexcept
+                    {
+                        // Empty body, elements are relocated by the owning collection.
+                    }
+
+                    StoragePolicy& operator=(StoragePolicy&&) noexcept
+                    {
+                        return *this;
+                    }
+
+                    T* data(void)
+                    {
+                        return reinterpret_cast<T*>(_data);
+                    }
+
+                    const T* data(void) const
+                    {
+                        return reinterpret_cast<const T*>(_data);
+                    }
+
+                    static constexpr size_t capacity(void)
+                    {
+                        return Capacity;
+                    }
+
+                    static constexpr bool is_valid(void)
+                    {
+                        return true;
+                    }
+
+                private:
+                    alignas(T) unsigned char _data[Capacity * sizeof(T)];
+                };
+
+                /**
+                 * Heap storage: the array is allocated once at construction and
+                 * freed on destruction. Capacity is chosen at runtime. Memory
+                 * comes from malloc, which is suitably aligned for any type
+                 * without extended alignment requirements.
+                 * @param T type contained in the owning collection.
+                 */
+                template<typename T>
+                class StoragePolicy<T, 0>
+                {
+                public:
+                    static constexpr bool IS_INLINE{ false };
+
+                    /**
+                     * Initializes this StoragePolicy with the provided capacity.
+                     * If allocation fails, or if capacity elements do not fit in
+                     * SIZE_MAX bytes, capacity is set to 0.
+                     * @param capacity must be strictly positive.
+                     */
+                    explicit StoragePolicy(size_t capacity)
+                        : _data{ capacity > 0 && capacity <= SIZE_MAX / sizeof(T)
+                            ? static_cast<T*>(malloc(capacity * sizeof(T))) : nullptr }
+                        , _capacity{ capacity }
+                    {
+                        if (_data == nullptr)
+                        {
+                            _capacity = 0;
+                        }
+                    }
+
+                    ~StoragePolicy(void)
+                    {
+                        free(_data);
+                    }
+
+                    // Forbid copy to avoid double free.
+                    StoragePolicy(const StoragePolicy&) = delete;
+                    StoragePolicy& operator=(const StoragePolicy&) = delete;
+
+                    StoragePolicy(StoragePolicy&& other) noexcept
+                        : _data{ other._data }, _capacity{ other._capacity }
+                    {
+                        other._data = nullptr;
+                        other._capacity = 0;
+                    }
+
+                    StoragePolicy& operator=(StoragePolicy&& other) noexcept
+                    {
+                        if (this != &other)
+                        {
+                            free(_data);
+
+                            _data = other._data;
+                            _capacity = other._capacity;
+
+                            other._data = nullptr;
+                            other._capacity = 0;
+                        }
+                        return *this;
+                    }
+
+                    T* data(void)
+                    {
+                        return _data;
+                    }
+
+                    const T* data(void) const
+                    {
+                        return _data;
+                    }
+
+                    size_t capacity(void) const
+                    {
+                        return _capacity;
+                    }
+
+                    bool is_valid(void) const
+                    {
+                        return _data != nullptr;
+                    }
+
+                private:
+                    T* _data{ };
+                    size_t _capacity{ };
+                };
+            }
+        }
+    }
+}
@@ -0,0 +1,195 @@
+/*
+ ******************************************************************************
+ *  AtomicIndex.hpp
+ *
+ *  Index types shared between a producer and a consumer context.
+ *
+ *  Author: Pierre DEBAS
+ *  Copyright (c) 2026
+ *
+ *  MIT License
+ *  https://github.com/Pierrolefou881/DuinoCollections
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Description:
+ *    AtomicIndex publishes an index written by one context (e.g. an ISR)
+ *    and read by another (e.g. loop()) without disabling interrupts for the
+ *    duration of a collection operation. PlainIndex exposes the same
+ *    interface without any synchronization so that collections can select
+ *    either one at compile time.
+ *
+ *    CAUTION: this file is an internal header and not part of the public API.
+ *
+ ******************************************************************************
+ */
+#pragma once
+#include <stddef.h>
+
+#if !defined(ARDUINO)
+#include <atomic>
+#elif defined(ARDUINO_ARCH_AVR)
+#include "ScopedInterruptLock.hpp"
+#endif
+
+namespace DuinoCollections
+{
+    namespace Internal
+    {
+        namespace Utils
+        {
+            /**
+             * Single-writer index with acquire / release semantics.
+             * Implementation is platform-dependent:
+             * <ul>
+             *     <li>Host builds (no ARDUINO macro): std::atomic, so that
+             *         collections can be stress-tested with threads.</li>
+             *     <li>AVR: size_t is 16 bits wide and cannot be read or written
+             *         in one instruction, the access itself (not the caller's
+             *         operation) is guarded by a two-instruction critical
+             *         section. Nesting inside an ISR is safe since the previous
+             *         interrupt state is restored.</li>
+             *     <li>Other cores (ESP32, RP2040, ARM...): GCC atomic built-ins
+             *         on a native word.</li>
+             * </ul>
+             */
+            class AtomicIndex final
+            {
+            public:
+                /**
+                 * Initializes this AtomicIndex with the provided value.
+                 * @param value initial index. Defaulted to 0.
+                 */
+                explicit AtomicIndex(size_t value = 0) : _value{ value }
+                {
+                    // Empty body.
+                }
+
+                // Forbid copy, indexes are owned by their collection.
+                AtomicIndex(const AtomicIndex&) = delete;
+                AtomicIndex& operator=(const AtomicIndex&) = delete;
+
+                /**
+                 * Reads the index from the context that owns (writes) it.
+                 * @return current value.
+                 */
+                size_t load_relaxed(void) const
+                {
+                #if !defined(ARDUINO)
+                    return _value.load(std::memory_order_relaxed);
+                #elif defined(ARDUINO_ARCH_AVR)
+                    ScopedInterruptLock lock{ };
+                    return _value;
+                #else
+                    return __atomic_load_n(&_value, __ATOMIC_RELAXED);
+                #endif
+                }
+
+                /**
+                 * Reads the index published by the other context. Every write
+                 * made before the matching store_release is visible afterwards.
+                 * @return current value.
+                 */
+                size_t load_acquire(void) const
+                {
+                #if !defined(ARDUINO)
+                    return _value.load(std::memory_order_acquire);
+                #elif defined(ARDUINO_ARCH_AVR)
+                    ScopedInterruptLock lock{ };
+                    return _value;
+                #else
+                    return __atomic_load_n(&_value, __ATOMIC_ACQUIRE);
+                #endif
+                }
+
+                /**
+                 * Writes the index without publishing previous writes.
+                 * Only meant for initialization or when no other context
+                 * can access the owning collection.
+                 * @param value new index.
+                 */
+                void store_relaxed(size_t value)
+                {
+                #if !defined(ARDUINO)
+                    _value.store(value, std::memory_order_relaxed);
+                #elif defined(ARDUINO_ARCH_AVR)
+                    ScopedInterruptLock lock{ };
+                    _value = value;
+                #else
+                    __atomic_store_n(&_value, value, __ATOMIC_RELAXED);
+                #endif
+                }
+
+                /**
+                 * Publishes the index. Every write made before this call is
+                 * visible to the context calling load_acquire afterwards.
+                 * @param value new index.
+                 */
+                void store_release(size_t value)
+                {
+                #if !defined(ARDUINO)
+                    _value.store(value, std::memory_order_release);
+                #elif defined(ARDUINO_ARCH_AVR)
+                    ScopedInterruptLock lock{ };
+                    _value = value;
+                #else
+                    __atomic_store_n(&_value, value, __ATOMIC_RELEASE);
+                #endif
+                }
+
+            private:
+            #if !defined(ARDUINO)
+                std::atomic<size_t> _value;
+            #elif defined(ARDUINO_ARCH_AVR)
+                volatile size_t _value;
+            #else
+                size_t _value;
+            #endif
+            };
+
+            /**
+             * Unsynchronized counterpart of AtomicIndex. Shares its interface
+             * so that the owning collection can pick one at compile time.
+             */
+            class PlainIndex final
+            {
+            public:
+                /**
+                 * Initializes this PlainIndex with the provided value.
+                 * @param value initial index. Defaulted to 0.
+                 */
+                explicit PlainIndex(size_t value = 0) : _value{ value }
+                {
+                    // Empty body.
+                }
+
+                // Forbid copy, indexes are owned by their collection.
+                PlainIndex(const PlainIndex&) = delete;
+                PlainIndex& operator=(const PlainIndex&) = delete;
+
+                size_t load_relaxed(void) const
+                {
+                    return _value;
+                }
+
+                size_t load_acquire(void) const
+                {
+                    return _value;
+                }
+
+                void store_relaxed(size_t value)
+                {
+                    _value = value;
+                }
+
+                void store_release(size_t value)
+                {
+                    _value = value;
+                }
+
+            private:
+                size_t _value;
+            };
+        }
+    }
+}
@@ -0,0 +1,307 @@
+/*
+ ******************************************************************************
+ *  Eytzinger.hpp
+ *
+ *  Eytzinger (breadth-first) layout of sorted arrays.
+ *
+ *  Author: Pierre DEBAS
+ *  Copyright (c) 2026
+ *
+ *  MIT License
+ *  https://github.com/Pierrolefou881/DuinoCollections
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Description:
+ *    A sorted array seen as a complete binary search tree and stored level
+ *    by level: slot 0 holds the root, slots 2i + 1 and 2i + 2 hold the
+ *    children of slot i. Searches walk down from the root, so the first
+ *    probes always hit the same few slots and the next ones are adjacent.
+ *    Used by frozen ordered collections. Rearrangement is done in place,
+ *    without any extra memory.
+ *
+ *    CAUTION: this file is an internal header and not part of the public API.
+ *
+ ******************************************************************************
+ */
+#pragma once
+#include <stddef.h>
+#include "TypeTraits.hpp"
+
+namespace DuinoCollections
+{
+    namespace Internal
+    {
+        namespace Utils
+        {
+            /**
+             * @param node 1-based breadth-first position.
+             * @param size number of nodes in the tree.
+             * @return the number of nodes in the subtree rooted at node.
+             */
+            inline size_t eytzinger_subtree_size(size_t node, size_t size)
+            {
+                size_t count = 0;
+                size_t first = node;
+                size_t last = node;
+                while (first <= size)
+                {
+                    count += (last < size ? last : size) - first + 1;
+                    first = (first << 1);
+                    last = (last << 1) + 1;
+                }
+                return count;
+            }
+
+            /**
+             * @param slot 0-based position in the Eytzinger layout.
+             * @param size number of elements.
+             * @return the position of slot in the sorted layout.
+             */
+            inline size_t eytzinger_rank(size_t slot, size_t size)
+            {
+                size_t node = slot + 1;
+                size_t rank = eytzinger_subtree_size(node << 1, size);
+                for (; node > 1; node >>= 1)
+                {
+                    // A right child comes after its parent and its sibling subtree.
+                    if (node & 1)
+                    {
+                        rank += eytzinger_subtree_size(node - 1, size) + 1;
+                    }
+                }
+                return rank;
+            }
+
+            /**
+             * @param rank position in the sorted layout, less than size.
+             * @param size number of elements.
+             * @return the slot of the element of rank in the Eytzinger layout.
+             *         Inverse of eytzinger_rank.
+             */
+            inline size_t eytzinger_select(size_t rank, size_t size)
+            {
+                size_t node = 1;
+                for (;;)
+                {
+                    auto left = eytzinger_subtree_size(node << 1, size);
+                    if (rank == left)
+                    {
+                        return node - 1;
+                    }
+                    if (rank < left)
+                    {
+                        node <<= 1;
+                    }
+                    else
+                    {
+                        rank -= left + 1;
+                        node = (node << 1) + 1;
+                    }
+                }
+            }
+
+            /**
+             * Determines whether start is the smallest slot of its cycle in the
+             * Eytzinger permutation, so that each cycle is rotated only once.
+             */
+            inline bool is_eytzinger_cycle_leader(size_t start, size_t size)
+            {
+                for (auto slot = eytzinger_rank(start, size); slot != start; slot = eytzinger_rank(slot, size))
+                {
+                    if (slot < start)
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            /**
+             * Rearranges a sorted array into the Eytzinger layout, in place,
+             * by rotating each cycle of the permutation once.
+             * Complexity: about O(n log^2 n) (cycle walks times rank cost).
+             * @param data sorted array.
+             * @param size number of elements in data.
+             */
+            template<typename T>
+            void to_eytzinger(T* data, size_t size)
+            {
+                for (size_t start = 0; start < size; start++)
+                {
+                    if (!is_eytzinger_cycle_leader(start, size))
+                    {
+                        continue;
+                    }
+
+                    // Each slot pulls the element of its rank.
+                    T carried = Utils::move(data[start]);
+                    auto slot = start;
+                    for (auto source = eytzinger_rank(slot, size); source != start; source = eytzinger_rank(slot, size))
+                    {
+                        data[slot] = Utils::move(data[source]);
+                        slot = source;
+                    }
+                    data[slot] = Utils::move(carried);
+                }
+            }
+
+            /**
+             * Rearranges an array in Eytzinger layout back into sorted order,
+             * in place. Inverse of to_eytzinger.
+             * @param data array in Eytzinger layout.
+             * @param size number of elements in data.
+             */
+            template<typename T>
+            void from_eytzinger(T* data, size_t size)
+            {
+                for (size_t start = 0; start < size; start++)
+                {
+                    if (!is_eytzinger_cycle_leader(start, size))
+                    {
+                        continue;
+                    }
+
+                    // Each slot pushes its element to its rank.
+                    T carried = Utils::move(data[start]);
+                    for (auto target = eytzinger_rank(start, size); target != start; target = eytzinger_rank(target, size))
+                    {
+                        T displaced = Utils::move(data[target]);
+                        data[target] = Utils::move(carried);
+                        carried = Utils::move(displaced);
+                    }
+                    data[start] = Utils::move(carried);
+                }
+            }
+
+            /**
+             * Lower bound on an array in Eytzinger layout. Walks down the tree
+             * without branching on the comparison, then climbs back to the
+             * last node where the walk went left.
+             * @param data array in Eytzinger layout.
+             * @param size number of elements in data.
+             * @param key to locate, comparable with T through order.
+             * @param order sorting order data was sorted with.
+             * @return the slot of the first element for which order(element, key)
+             *         is false, size if none.
+             */
+            template<typename T, typename Key, typename Order>
+            size_t eytzinger_lower_bound(const T* data, size_t size, const Key& key, const Order& order)
+            {
+                size_t node = 1;
+                while (node <= size)
+                {
+                    node = (node << 1) + (order(data[node - 1], key) ? 1 : 0);
+                }
+
+                // Drop the trailing right turns, then the last left turn.
+                while (node & 1)
+                {
+                    node >>= 1;
+                }
+                node >>= 1;
+
+                return node == 0 ? size : node - 1;
+            }
+
+            /**
+             * @param size number of elements in Eytzinger layout.
+             * @return the slot of the first element in sorted order, size if none.
+             */
+            inline size_t eytzinger_first(size_t size)
+            {
+                if (size == 0)
+                {
+                    return size;
+                }
+
+                size_t node = 1;
+                while ((node << 1) <= size)
+                {
+                    node <<= 1;
+                }
+                return node - 1;
+            }
+
+            /**
+             * In-order successor in the Eytzinger layout: leftmost node of the
+             * right subtree, or first ancestor reached from a left child.
+             * Amortized O(1) over a whole walk.
+             * @param slot of the current element.
+             * @param size number of elements in Eytzinger layout.
+             * @return the slot of the next element in sorted order, size if none.
+             */
+            inline size_t eytzinger_next(size_t slot, size_t size)
+            {
+                size_t node = slot + 1;
+                if ((node << 1) + 1 <= size)
+                {
+                    node = (node << 1) + 1;
+                    while ((node << 1) <= size)
+                    {
+                        node <<= 1;
+                    }
+                    return node - 1;
+                }
+
+                while (node & 1)
+                {
+                    node >>= 1;
+                }
+                node >>= 1;
+                return node == 0 ? size : node - 1;
+            }
+
+            /**
+             * Walks the elements of a sorted array, or of an array in Eytzinger
+             * layout, in sorted order.
+             * @param T element type.
+             */
+            template<typename T>
+            struct SortedCursor
+            {
+                SortedCursor(const T* a_data, size_t a_size, bool a_is_frozen)
+                    : data{ a_data }, size{ a_size }, is_frozen{ a_is_frozen }
+                    , slot{ a_is_frozen ? eytzinger_first(a_size) : 0 }
+                {
+                    // Empty body.
+                }
+
+                bool is_done(void) const
+                {
+                    return slot >= size;
+                }
+
+                const T& get(void) const
+                {
+                    return data[slot];
+                }
+
+                void advance(void)
+                {
+                    slot = is_frozen ? eytzinger_next(slot, size) : slot + 1;
+                }
+
+                const T* data;
+                size_t size;
+                bool is_frozen;
+                size_t slot;
+            };
+
+            /**
+             * Finds an element equal to key in an array in Eytzinger layout.
+             * @param data array in Eytzinger layout.
+             * @param size number of elements in data.
+             * @param key to find, comparable with T through order and ==.
+             * @param order sorting order data was sorted with.
+             * @return the slot of the found element, size otherwise.
+             */
+            template<typename T, typename Key, typename Order>
+            size_t eytzinger_find(const T* data, size_t size, const Key& key, const Order& order)
+            {
+                auto slot = eytzinger_lower_bound(data, size, key, order);
+                return (slot < size && data[slot] == key) ? slot : size;
+            }
+        }
+    }
+}
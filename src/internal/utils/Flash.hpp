@@ -0,0 +1,56 @@
+/*
+ ******************************************************************************
+ *  Flash.hpp
+ *
+ *  Reads constant data that may live in program memory.
+ *
+ *  Author: Pierre DEBAS
+ *  Copyright (c) 2026
+ *
+ *  MIT License
+ *  https://github.com/Pierrolefou881/DuinoCollections
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Description:
+ *    On AVR, data declared PROGMEM stays in flash and lives in a separate
+ *    address space: it must be copied with memcpy_P before use. Other
+ *    targets map flash into the data address space, constant data is read
+ *    directly.
+ *
+ *    CAUTION: this file is an internal header and not part of the public API.
+ *
+ ******************************************************************************
+ */
+#pragma once
+#if defined(ARDUINO_ARCH_AVR)
+#include <avr/pgmspace.h>
+#endif
+
+namespace DuinoCollections
+{
+    namespace Internal
+    {
+        namespace Utils
+        {
+            /**
+             * Reads a value from program memory (PROGMEM).
+             * CAUTION: on AVR, source must point to flash. T must be
+             * trivially copyable.
+             * @param source address of the value in program memory.
+             * @return a copy of the value.
+             */
+            template<typename T>
+            T read_flash(const T* source)
+            {
+            #if defined(ARDUINO_ARCH_AVR)
+                T value;
+                memcpy_P(&value, source, sizeof(T));
+                return value;
+            #else
+                return *source;
+            #endif
+            }
+        }
+    }
+}
@@ -0,0 +1,70 @@
+/*
+ ******************************************************************************
+ *  HashTable.hpp
+ *
+ *  Sizing helpers for open-addressing hash tables.
+ *
+ *  Author: Pierre DEBAS
+ *  Copyright (c) 2026
+ *
+ *  MIT License
+ *  https://github.com/Pierrolefou881/DuinoCollections
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Description:
+ *    Hashed collections use power-of-two tables so that a bucket is found
+ *    with a mask instead of a division. This header computes table sizes
+ *    at compile time for inline storage and at construction otherwise.
+ *
+ *    CAUTION: this file is an internal header and not part of the public API.
+ *
+ ******************************************************************************
+ */
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include "TypeTraits.hpp"
+
+namespace DuinoCollections
+{
+    namespace Internal
+    {
+        namespace Utils
+        {
+            /**
+             * Computes the number of buckets of a hash table: smallest power of
+             * two keeping the load under max_load_percent when capacity elements
+             * are stored. Always greater than capacity, so a probe sequence
+             * always meets a free bucket.
+             * @param capacity maximum number of elements.
+             * @param max_load_percent maximum load factor, in ]0, 100[.
+             * @param candidate power of two to try, starts at 2.
+             * @return the number of buckets, 0 if no size_t power of two
+             *         is large enough.
+             */
+            constexpr size_t hash_table_capacity(size_t capacity, size_t max_load_percent, size_t candidate = 2)
+            {
+                // candidate * max_load_percent / 100 >= capacity, without overflow.
+                return candidate == 0
+                    ? 0
+                    : candidate / 100 * max_load_percent + candidate % 100 * max_load_percent / 100 >= capacity
+                        && candidate > capacity
+                    ? candidate
+                    : hash_table_capacity(capacity, max_load_percent, candidate << 1);
+            }
+
+            /**
+             * Smallest unsigned type holding every value up to Max, used for
+             * compact indices of inline hash tables.
+             * @param Max greatest value to hold.
+             */
+            template<unsigned long long Max>
+            struct SmallestUnsigned
+            {
+                using type = typename Conditional<Max <= 0xFF, uint8_t,
+                    typename Conditional<Max <= 0xFFFF, uint16_t, size_t>::type>::type;
+            };
+        }
+    }
+}
@@ -0,0 +1,204 @@
+/*
+ ******************************************************************************
+ *  Memory.hpp
+ *
+ *  Element lifetimes and block transfers for array-backed collections.
+ *
+ *  Author: Pierre DEBAS
+ *  Copyright (c) 2026
+ *
+ *  MIT License
+ *  https://github.com/Pierrolefou881/DuinoCollections
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Description:
+ *    Collections store their elements in raw, uninitialized memory: an
+ *    element is constructed in place when inserted and destroyed when
+ *    removed. This header provides the construction / destruction helpers
+ *    and the block transfers built on them, using memcpy / memmove when the
+ *    element type allows it and element by element otherwise.
+ *
+ *    CAUTION: this file is an internal header and not part of the public API.
+ *
+ ******************************************************************************
+ */
+#pragma once
+#include <stddef.h>
+#include <string.h>
+#if defined(ARDUINO_ARCH_AVR)
+#include <new.h>
+#else
+#include <new>
+#endif
+#include "TypeTraits.hpp"
+
+namespace DuinoCollections
+{
+    namespace Internal
+    {
+        namespace Utils
+        {
+            /**
+             * Constructs an element in place in raw memory.
+             * CAUTION: Undefined behavior if location already holds a live element.
+             * @param location where to construct the element.
+             * @param args arguments forwarded to the constructor of T.
+             */
+            template<typename T, typename... Args>
+            void construct_at(T* location, Args&&... args)
+            {
+                ::new (static_cast<void*>(location)) T(Utils::forward<Args>(args)...);
+            }
+
+            /**
+             * Ends the lifetime of the element at the provided location. Memory
+             * is left raw and ready for construct_at.
+             * @param location of the live element to destroy.
+             */
+            template<typename T>
+            void destroy_at(T* location)
+            {
+                location->~T();
+            }
+
+            /**
+             * Block transfer implementation, selected on whether T is
+             * trivially copyable.
+             * @param T type of elements to transfer.
+             * @param IsTrivial true if T can be copied bytewise.
+             */
+            template<typename T, bool IsTrivial = IsTriviallyCopyable<T>::value>
+            struct BlockTransfer
+            {
+                static void copy(T* destination, const T* source, size_t count)
+                {
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        destination[i] = source[i];
+                    }
+                }
+
+                static void construct_copy(T* destination, const T* source, size_t count)
+                {
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        Utils::construct_at(destination + i, source[i]);
+                    }
+                }
+
+                static void relocate(T* destination, T* source, size_t count)
+                {
+                    if (destination < source)
+                    {
+                        for (size_t i = 0; i < count; ++i)
+                        {
+                            Utils::construct_at(destination + i, Utils::move(source[i]));
+                            Utils::destroy_at(source + i);
+                        }
+                    }
+                    else
+                    {
+                        for (size_t i = count; i > 0; --i)
+                        {
+                            Utils::construct_at(destination + i - 1, Utils::move(source[i - 1]));
+                            Utils::destroy_at(source + i - 1);
+                        }
+                    }
+                }
+
+                static void destroy(T* first, size_t count)
+                {
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        Utils::destroy_at(first + i);
+                    }
+                }
+            };
+
+            template<typename T>
+            struct BlockTransfer<T, true>
+            {
+                static void copy(T* destination, const T* source, size_t count)
+                {
+                    if (count > 0)
+                    {
+                        memcpy(destination, source, count * sizeof(T));
+                    }
+                }
+
+                static void construct_copy(T* destination, const T* source, size_t count)
+                {
+                    copy(destination, source, count);
+                }
+
+                static void relocate(T* destination, T* source, size_t count)
+                {
+                    if (count > 0)
+                    {
+                        memmove(destination, source, count * sizeof(T));
+                    }
+                }
+
+                static void destroy(T* /*first*/, size_t /*count*/)
+                {
+                    // Trivially copyable types have a trivial destructor.
+                }
+            };
+
+            /**
+             * Copies count elements from source to live elements in destination.
+             * CAUTION: ranges must not overlap.
+             * @param destination first live element to overwrite.
+             * @param source first element to read.
+             * @param count number of elements to copy.
+             */
+            template<typename T>
+            void copy_elements(T* destination, const T* source, size_t count)
+            {
+                BlockTransfer<T>::copy(destination, source, count);
+            }
+
+            /**
+             * Copy-constructs count elements from source into raw memory.
+             * CAUTION: ranges must not overlap.
+             * @param destination first raw slot to construct.
+             * @param source first element to read.
+             * @param count number of elements to copy.
+             */
+            template<typename T>
+            void construct_elements(T* destination, const T* source, size_t count)
+            {
+                BlockTransfer<T>::construct_copy(destination, source, count);
+            }
+
+            /**
+             * Relocates count live elements from source to raw memory at
+             * destination: each element is moved into its new slot then
+             * destroyed in the old one. Ranges may overlap, which makes it
+             * suitable for shifting elements within an array. Slots of source
+             * not covered by destination are left raw.
+             * @param destination first slot to construct.
+             * @param source first live element to relocate.
+             * @param count number of elements to relocate.
+             */
+            template<typename T>
+            void relocate_elements(T* destination, T* source, size_t count)
+            {
+                BlockTransfer<T>::relocate(destination, source, count);
+            }
+
+            /**
+             * Destroys count live elements, leaving their memory raw.
+             * No-op for trivially copyable types.
+             * @param first live element to destroy.
+             * @param count number of elements to destroy.
+             */
+            template<typename T>
+            void destroy_elements(T* first, size_t count)
+            {
+                BlockTransfer<T>::destroy(first, count);
+            }
+        }
+    }
+}
@@ -21,7 +21,11 @@
  ******************************************************************************
  */
 #pragma once
+#if defined(ARDUINO)
 #include <Arduino.h>
+#else
+#include <stddef.h>
+#endif
 
 namespace DuinoCollections
 {
@@ -39,6 +43,9 @@ namespace DuinoCollections
              *
              * The previous interrupt state is preserved so nested usage is safe.
              *
+             * On host builds (no ARDUINO macro) there are no interrupts to mask
+             * and this lock does nothing.
+             *
              * @warning Must not be used inside an ISR.
              */
             class ScopedInterruptLock final
@@ -51,15 +58,19 @@ namespace DuinoCollections
                 ScopedInterruptLock()
                 {
                     _were_enabled = interruptsEnabled();
+                #if defined(ARDUINO)
                     noInterrupts();
+                #endif
                 }
 
                 ~ScopedInterruptLock()
                 {
+                #if defined(ARDUINO)
                     if (_were_enabled)
                     {
                         interrupts();
                     }
+                #endif
                 }
 
                 // Forbid copy.
@@ -0,0 +1,124 @@
+/*
+ ******************************************************************************
+ *  Sort.hpp
+ *
+ *  In-place sorting of element arrays.
+ *
+ *  Author: Pierre DEBAS
+ *  Copyright (c) 2026
+ *
+ *  MIT License
+ *  https://github.com/Pierrolefou881/DuinoCollections
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Description:
+ *    Sorting and deduplication helpers used by bulk insertions into ordered
+ *    collections. Heap sort is used: O(n log n) in the worst case, no
+ *    recursion and no extra buffer, which suits small stacks and the
+ *    absence of heap allocation. It is not stable.
+ *
+ *    CAUTION: this file is an internal header and not part of the public API.
+ *
+ ******************************************************************************
+ */
+#pragma once
+#include <stddef.h>
+#include "Memory.hpp"
+#include "TypeTraits.hpp"
+
+namespace DuinoCollections
+{
+    namespace Internal
+    {
+        namespace Utils
+        {
+            /**
+             * Moves the element at root down the max-heap data[0, size) until
+             * both of its children come before it in order.
+             * @param data array holding the heap.
+             * @param root index of the element to sift down.
+             * @param size number of elements in the heap.
+             * @param order sorting order, the heap root comes last in order.
+             */
+            template<typename T, typename Order>
+            void sift_down(T* data, size_t root, size_t size, const Order& order)
+            {
+                T carried = Utils::move(data[root]);
+                auto hole = root;
+                for (auto child = (hole << 1) + 1; child < size; child = (hole << 1) + 1)
+                {
+                    if (child + 1 < size && order(data[child], data[child + 1]))
+                    {
+                        child++;
+                    }
+                    if (!order(carried, data[child]))
+                    {
+                        break;
+                    }
+                    data[hole] = Utils::move(data[child]);
+                    hole = child;
+                }
+                data[hole] = Utils::move(carried);
+            }
+
+            /**
+             * Sorts data in place with heap sort.
+             * Complexity: O(n log n), no extra memory.
+             * @param data array to sort.
+             * @param size number of elements in data.
+             * @param order sorting order, order(a, b) is true if a comes before b.
+             */
+            template<typename T, typename Order>
+            void heap_sort(T* data, size_t size, const Order& order)
+            {
+                for (auto root = size >> 1; root > 0; root--)
+                {
+                    sift_down(data, root - 1, size, order);
+                }
+
+                for (auto end = size; end > 1; end--)
+                {
+                    T last = Utils::move(data[end - 1]);
+                    data[end - 1] = Utils::move(data[0]);
+                    data[0] = Utils::move(last);
+                    sift_down(data, 0, end - 1, order);
+                }
+            }
+
+            /**
+             * Removes consecutive equal elements (==) from data, keeping the
+             * first one of each group. Removed elements are destroyed.
+             * Complexity: O(n)
+             * @param data sorted array.
+             * @param size number of elements in data.
+             * @return the number of elements kept, compacted at the front.
+             */
+            template<typename T>
+            size_t unique_elements(T* data, size_t size)
+            {
+                if (size == 0)
+                {
+                    return 0;
+                }
+
+                size_t write = 1;
+                for (size_t read = 1; read < size; read++)
+                {
+                    if (data[read] == data[write - 1])
+                    {
+                        continue;
+                    }
+                    if (write != read)
+                    {
+                        data[write] = Utils::move(data[read]);
+                    }
+                    write++;
+                }
+
+                Utils::destroy_elements(data + write, size - write);
+                return write;
+            }
+        }
+    }
+}
@@ -0,0 +1,114 @@
+/*
+ ******************************************************************************
+ *  TypeTraits.hpp
+ *
+ *  Minimal compile-time type utilities for the DuinoCollections library.
+ *
+ *  Author: Pierre DEBAS
+ *  Copyright (c) 2026
+ *
+ *  MIT License
+ *  https://github.com/Pierrolefou881/DuinoCollections
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Description:
+ *    Several Arduino cores (AVR in particular) do not ship the C++ standard
+ *    library, hence no <type_traits>. This header provides the few traits
+ *    the collections rely on.
+ *
+ *    CAUTION: this file is an internal header and not part of the public API.
+ *
+ ******************************************************************************
+ */
+#pragma once
+
+namespace DuinoCollections
+{
+    namespace Internal
+    {
+        namespace Utils
+        {
+            /**
+             * Selects a type at compile time.
+             * Conditional<true, A, B>::type is A, Conditional<false, A, B>::type is B.
+             * @param Condition compile-time boolean.
+             * @param IfTrue type selected when Condition holds.
+             * @param IfFalse type selected otherwise.
+             */
+            template<bool Condition, typename IfTrue, typename IfFalse>
+            struct Conditional
+            {
+                using type = IfTrue;
+            };
+
+            template<typename IfTrue, typename IfFalse>
+            struct Conditional<false, IfTrue, IfFalse>
+            {
+                using type = IfFalse;
+            };
+
+            /**
+             * IsTriviallyCopyable<T>::value is true if T can be copied with
+             * memcpy / memmove (integral types, floats, POD structs...).
+             * Relies on the compiler built-in available in GCC and Clang.
+             * @param T type to inspect.
+             */
+            template<typename T>
+            struct IsTriviallyCopyable
+            {
+                static constexpr bool value = __is_trivially_copyable(T);
+            };
+
+            /**
+             * RemoveReference<T>::type is T stripped from any reference.
+             * @param T type to strip.
+             */
+            template<typename T>
+            struct RemoveReference
+            {
+                using type = T;
+            };
+
+            template<typename T>
+            struct RemoveReference<T&>
+            {
+                using type = T;
+            };
+
+            template<typename T>
+            struct RemoveReference<T&&>
+            {
+                using type = T;
+            };
+
+            /**
+             * Equivalent of std::move for cores without <utility>.
+             * @param value to cast to an rvalue reference.
+             * @return value as an rvalue reference.
+             */
+            template<typename T>
+            constexpr typename RemoveReference<T>::type&& move(T&& value) noexcept
+            {
+                return static_cast<typename RemoveReference<T>::type&&>(value);
+            }
+
+            /**
+             * Equivalent of std::forward for cores without <utility>.
+             * @param value to forward with its original value category.
+             * @return value as an lvalue or rvalue reference, depending on T.
+             */
+            template<typename T>
+            constexpr T&& forward(typename RemoveReference<T>::type& value) noexcept
+            {
+                return static_cast<T&&>(value);
+            }
+
+            template<typename T>
+            constexpr T&& forward(typename RemoveReference<T>::type&& value) noexcept
+            {
+                return static_cast<T&&>(value);
+            }
+        }
+    }
+}
@@ -0,0 +1,334 @@
+/*
+ ******************************************************************************
+ *  VectorScan.hpp
+ *
+ *  Vectorized equality scan of arithmetic arrays.
+ *
+ *  Author: Pierre DEBAS
+ *  Copyright (c) 2026
+ *
+ *  MIT License
+ *  https://github.com/Pierrolefou881/DuinoCollections
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Description:
+ *    Linear searches of arithmetic elements compare a whole vector register
+ *    of elements at once and turn the result into a bit mask (compare and
+ *    movemask): 16 bytes per iteration with SSE2, 32 with AVX2. Other types
+ *    and targets without these instruction sets (AVR, ARM, Xtensa...) use
+ *    the scalar loop.
+ *
+ *    CAUTION: this file is an internal header and not part of the public API.
+ *
+ ******************************************************************************
+ */
+#pragma once
+#include <stddef.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace DuinoCollections
+{
+    namespace Internal
+    {
+        namespace Utils
+        {
+            /**
+             * Vector lane operations for T. Specialized for arithmetic types
+             * when the target supports SSE2, scalar scan otherwise.
+             * @param T element type.
+             */
+            template<typename T>
+            struct VectorLane
+            {
+                static const bool IS_VECTORIZED{ false };
+            };
+
+#if defined(__SSE2__)
+            /**
+             * Lane operations for integral types, selected by their size.
+             * Every byte of an equal element is set in the comparison result.
+             * @param Size of the integral type in bytes.
+             */
+            template<size_t Size>
+            struct IntegerLane;
+
+            template<>
+            struct IntegerLane<1>
+            {
+                static const bool IS_VECTORIZED{ true };
+
+                template<typename T>
+                static __m128i splat(T value)
+                {
+                    return _mm_set1_epi8(static_cast<char>(value));
+                }
+
+                static __m128i equal(__m128i a, __m128i b)
+                {
+                    return _mm_cmpeq_epi8(a, b);
+                }
+
+#if defined(__AVX2__)
+                template<typename T>
+                static __m256i splat256(T value)
+                {
+                    return _mm256_set1_epi8(static_cast<char>(value));
+                }
+
+                static __m256i equal256(__m256i a, __m256i b)
+                {
+                    return _mm256_cmpeq_epi8(a, b);
+                }
+#endif
+            };
+
+            template<>
+            struct IntegerLane<2>
+            {
+                static const bool IS_VECTORIZED{ true };
+
+                template<typename T>
+                static __m128i splat(T value)
+                {
+                    return _mm_set1_epi16(static_cast<short>(value));
+                }
+
+                static __m128i equal(__m128i a, __m128i b)
+                {
+                    return _mm_cmpeq_epi16(a, b);
+                }
+
+#if defined(__AVX2__)
+                template<typename T>
+                static __m256i splat256(T value)
+                {
+                    return _mm256_set1_epi16(static_cast<short>(value));
+                }
+
+                static __m256i equal256(__m256i a, __m256i b)
+                {
+                    return _mm256_cmpeq_epi16(a, b);
+                }
+#endif
+            };
+
+            template<>
+            struct IntegerLane<4>
+            {
+                static const bool IS_VECTORIZED{ true };
+
+                template<typename T>
+                static __m128i splat(T value)
+                {
+                    return _mm_set1_epi32(static_cast<int>(value));
+                }
+
+                static __m128i equal(__m128i a, __m128i b)
+                {
+                    return _mm_cmpeq_epi32(a, b);
+                }
+
+#if defined(__AVX2__)
+                template<typename T>
+                static __m256i splat256(T value)
+                {
+                    return _mm256_set1_epi32(static_cast<int>(value));
+                }
+
+                static __m256i equal256(__m256i a, __m256i b)
+                {
+                    return _mm256_cmpeq_epi32(a, b);
+                }
+#endif
+            };
+
+            template<>
+            struct IntegerLane<8>
+            {
+                static const bool IS_VECTORIZED{ true };
+
+                template<typename T>
+                static __m128i splat(T value)
+                {
+                    return _mm_set1_epi64x(static_cast<long long>(value));
+                }
+
+                static __m128i equal(__m128i a, __m128i b)
+                {
+                    // SSE2 has no 64-bit comparison: both 32-bit halves must match.
+                    auto halves = _mm_cmpeq_epi32(a, b);
+                    return _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+                }
+
+#if defined(__AVX2__)
+                template<typename T>
+                static __m256i splat256(T value)
+                {
+                    return _mm256_set1_epi64x(static_cast<long long>(value));
+                }
+
+                static __m256i equal256(__m256i a, __m256i b)
+                {
+                    return _mm256_cmpeq_epi64(a, b);
+                }
+#endif
+            };
+
+            template<> struct VectorLane<bool> : IntegerLane<sizeof(bool)> { };
+            template<> struct VectorLane<char> : IntegerLane<sizeof(char)> { };
+            template<> struct VectorLane<signed char> : IntegerLane<sizeof(signed char)> { };
+            template<> struct VectorLane<unsigned char> : IntegerLane<sizeof(unsigned char)> { };
+            template<> struct VectorLane<short> : IntegerLane<sizeof(short)> { };
+            template<> struct VectorLane<unsigned short> : IntegerLane<sizeof(unsigned short)> { };
+            template<> struct VectorLane<int> : IntegerLane<sizeof(int)> { };
+            template<> struct VectorLane<unsigned int> : IntegerLane<sizeof(unsigned int)> { };
+            template<> struct VectorLane<long> : IntegerLane<sizeof(long)> { };
+            template<> struct VectorLane<unsigned long> : IntegerLane<sizeof(unsigned long)> { };
+            template<> struct VectorLane<long long> : IntegerLane<sizeof(long long)> { };
+            template<> struct VectorLane<unsigned long long> : IntegerLane<sizeof(unsigned long long)> { };
+
+            /**
+             * Floating point lanes compare values, not bits: 0.0 equals -0.0
+             * and NaN equals nothing, as with operator ==.
+             */
+            template<>
+            struct VectorLane<float>
+            {
+                static const bool IS_VECTORIZED{ true };
+
+                static __m128i splat(float value)
+                {
+                    return _mm_castps_si128(_mm_set1_ps(value));
+                }
+
+                static __m128i equal(__m128i a, __m128i b)
+                {
+                    return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+                }
+
+#if defined(__AVX2__)
+                static __m256i splat256(float value)
+                {
+                    return _mm256_castps_si256(_mm256_set1_ps(value));
+                }
+
+                static __m256i equal256(__m256i a, __m256i b)
+                {
+                    return _mm256_castps_si256(
+                        _mm256_cmp_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ));
+                }
+#endif
+            };
+
+            template<>
+            struct VectorLane<double>
+            {
+                static const bool IS_VECTORIZED{ true };
+
+                static __m128i splat(double value)
+                {
+                    return _mm_castpd_si128(_mm_set1_pd(value));
+                }
+
+                static __m128i equal(__m128i a, __m128i b)
+                {
+                    return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+                }
+
+#if defined(__AVX2__)
+                static __m256i splat256(double value)
+                {
+                    return _mm256_castpd_si256(_mm256_set1_pd(value));
+                }
+
+                static __m256i equal256(__m256i a, __m256i b)
+                {
+                    return _mm256_castpd_si256(
+                        _mm256_cmp_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ));
+                }
+#endif
+            };
+#endif
+
+            /**
+             * Equality scan implementation, selected on whether T has
+             * vector lanes on this target.
+             * @param T element type.
+             * @param IsVectorized VectorLane<T>::IS_VECTORIZED.
+             */
+            template<typename T, bool IsVectorized = VectorLane<T>::IS_VECTORIZED>
+            struct VectorScan
+            {
+                static size_t find_equal(const T* data, size_t size, const T& value)
+                {
+                    for (size_t i = 0; i < size; ++i)
+                    {
+                        if (data[i] == value)
+                        {
+                            return i;
+                        }
+                    }
+                    return size;
+                }
+            };
+
+#if defined(__SSE2__)
+            template<typename T>
+            struct VectorScan<T, true>
+            {
+                static size_t find_equal(const T* data, size_t size, const T& value)
+                {
+                    using Lane = VectorLane<T>;
+                    size_t i = 0;
+
+#if defined(__AVX2__)
+                    auto needle256 = Lane::splat256(value);
+                    for (; i + 32 / sizeof(T) <= size; i += 32 / sizeof(T))
+                    {
+                        auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                        auto mask = static_cast<unsigned>(_mm256_movemask_epi8(Lane::equal256(chunk, needle256)));
+                        if (mask != 0)
+                        {
+                            return i + __builtin_ctz(mask) / sizeof(T);
+                        }
+                    }
+#endif
+
+                    auto needle = Lane::splat(value);
+                    for (; i + 16 / sizeof(T) <= size; i += 16 / sizeof(T))
+                    {
+                        auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                        auto mask = static_cast<unsigned>(_mm_movemask_epi8(Lane::equal(chunk, needle)));
+                        if (mask != 0)
+                        {
+                            return i + __builtin_ctz(mask) / sizeof(T);
+                        }
+                    }
+
+                    return i + VectorScan<T, false>::find_equal(data + i, size - i, value);
+                }
+            };
+#endif
+
+            /**
+             * Finds the first element equal to value, comparing a vector of
+             * elements per iteration when T has vector lanes on this target.
+             * @param data array to scan.
+             * @param size number of elements in data.
+             * @param value to find.
+             * @return the index of the first element equal to value, size if none.
+             */
+            template<typename T>
+            size_t find_equal(const T* data, size_t size, const T& value)
+            {
+                return VectorScan<T>::find_equal(data, size, value);
+            }
+        }
+    }
+}